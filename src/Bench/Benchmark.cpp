@@ -0,0 +1,106 @@
+#include "Benchmark.h"
+#include "../Trace/EscaparJSON.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+
+using namespace std;
+
+namespace {
+
+// Percentil pelo método do posto mais próximo (amostras já ordenadas)
+double percentil(const vector<double>& ordenadas, double p) {
+    size_t posto = static_cast<size_t>(ceil(p / 100.0 * ordenadas.size()));
+    if (posto < 1) posto = 1;
+    return ordenadas[posto - 1];
+}
+
+} // namespace
+
+// Construtor
+ExecutorBench::ExecutorBench(int aquecimento, int repeticoes)
+    : aquecimento(max(0, aquecimento)), repeticoes(max(1, repeticoes)), sumidouro(0) {}
+
+void ExecutorBench::setFiltro(const string& novoFiltro) {
+    filtro = novoFiltro;
+}
+
+void ExecutorBench::medir(const string& grupo, const string& caso, long long itens,
+                          const function<void()>& funcao, const function<void()>& preparar) {
+    if (!filtro.empty() && (grupo + "/" + caso).find(filtro) == string::npos) {
+        return;
+    }
+
+    for (int i = 0; i < aquecimento; i++) {
+        if (preparar) preparar();
+        funcao();
+    }
+
+    vector<double> amostras;
+    amostras.reserve(repeticoes);
+    for (int i = 0; i < repeticoes; i++) {
+        if (preparar) preparar();
+        auto inicio = chrono::steady_clock::now();
+        funcao();
+        auto fim = chrono::steady_clock::now();
+        amostras.push_back(static_cast<double>(chrono::duration_cast<chrono::nanoseconds>(fim - inicio).count()));
+    }
+    sort(amostras.begin(), amostras.end());
+
+    ResultadoBench r;
+    r.grupo = grupo;
+    r.caso = caso;
+    r.repeticoes = repeticoes;
+    r.itensPorRepeticao = itens;
+    r.minNs = amostras.front();
+    r.medianaNs = percentil(amostras, 50);
+    r.p99Ns = percentil(amostras, 99);
+    double soma = 0;
+    for (double a : amostras) soma += a;
+    r.mediaNs = soma / amostras.size();
+    r.itensPorSegundo = r.medianaNs > 0 ? itens * 1e9 / r.medianaNs : 0;
+    resultados.push_back(r);
+
+    // Progresso em stderr: não mistura com CSV/JSON redirecionados de stdout
+    cerr << "  " << grupo << "/" << caso << ": mediana " << fixed << setprecision(1)
+         << r.medianaNs / 1000.0 << " us" << endl;
+}
+
+void ExecutorBench::imprimirTabela(ostream& saida) const {
+    saida << left << setw(16) << "grupo" << setw(48) << "caso" << right
+          << setw(12) << "min(us)" << setw(12) << "mediana(us)" << setw(12) << "p99(us)"
+          << setw(16) << "itens/s" << endl;
+    saida << string(116, '-') << endl;
+    for (const ResultadoBench& r : resultados) {
+        saida << left << setw(16) << r.grupo << setw(48) << r.caso << right << fixed << setprecision(1)
+              << setw(12) << r.minNs / 1000.0 << setw(12) << r.medianaNs / 1000.0
+              << setw(12) << r.p99Ns / 1000.0 << setw(16) << setprecision(0) << r.itensPorSegundo << endl;
+    }
+}
+
+void ExecutorBench::escreverCSV(ostream& saida) const {
+    saida << "grupo,caso,repeticoes,itens,min_ns,mediana_ns,p99_ns,media_ns,itens_por_segundo\n";
+    saida << fixed << setprecision(0);
+    for (const ResultadoBench& r : resultados) {
+        saida << r.grupo << ',' << r.caso << ',' << r.repeticoes << ',' << r.itensPorRepeticao << ','
+              << r.minNs << ',' << r.medianaNs << ',' << r.p99Ns << ',' << r.mediaNs << ','
+              << setprecision(1) << r.itensPorSegundo << setprecision(0) << '\n';
+    }
+}
+
+void ExecutorBench::escreverJSON(ostream& saida, const string& descricaoMaquina) const {
+    saida << fixed << setprecision(0);
+    saida << "{\n  \"maquina\": \"" << escaparJSON(descricaoMaquina) << "\",\n  \"resultados\": [";
+    for (size_t i = 0; i < resultados.size(); i++) {
+        const ResultadoBench& r = resultados[i];
+        saida << (i ? ",\n" : "\n")
+              << "    {\"grupo\": \"" << escaparJSON(r.grupo) << "\", \"caso\": \"" << escaparJSON(r.caso)
+              << "\", \"repeticoes\": " << r.repeticoes << ", \"itens\": " << r.itensPorRepeticao
+              << ", \"min_ns\": " << r.minNs << ", \"mediana_ns\": " << r.medianaNs
+              << ", \"p99_ns\": " << r.p99Ns << ", \"media_ns\": " << r.mediaNs
+              << ", \"itens_por_segundo\": " << setprecision(1) << r.itensPorSegundo << setprecision(0) << "}";
+    }
+    saida << "\n  ]\n}\n";
+}
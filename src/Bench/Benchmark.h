@@ -0,0 +1,57 @@
+#ifndef BENCHMARK_H
+#define BENCHMARK_H
+
+#include <functional>
+#include <ostream>
+#include <string>
+#include <vector>
+
+// Resultado de um caso de benchmark (tempos por repetição, em ns)
+struct ResultadoBench {
+    std::string grupo;          // ex.: "validacao9x9", "solver"
+    std::string caso;           // ex.: "iniciarValidacaoParalela"
+    int repeticoes;
+    long long itensPorRepeticao;
+    double minNs;
+    double medianaNs;
+    double p99Ns;
+    double mediaNs;
+    double itensPorSegundo;     // calculado a partir da mediana
+};
+
+// Executor de benchmarks.
+// Cada caso roda 'aquecimento' vezes sem medir e depois 'repeticoes' vezes,
+// medindo cada repetição isoladamente com o relógio monotônico. A função
+// 'preparar' (opcional) roda antes de cada repetição, fora da região medida.
+class ExecutorBench {
+public:
+    ExecutorBench(int aquecimento, int repeticoes);
+
+    // Só casos cujo "grupo/caso" contém 'filtro' são executados (vazio = todos)
+    void setFiltro(const std::string& filtro);
+
+    // Mede 'funcao' e guarda o resultado; 'itens' é o trabalho feito por repetição
+    // (tabuleiros validados, quebra-cabeças resolvidos...), usado na vazão
+    void medir(const std::string& grupo, const std::string& caso, long long itens,
+               const std::function<void()>& funcao,
+               const std::function<void()>& preparar = std::function<void()>());
+
+    // Acumula um valor calculado pelo caso para que o compilador não o descarte
+    void consumir(long long valor) { sumidouro += valor; }
+
+    const std::vector<ResultadoBench>& getResultados() const { return resultados; }
+
+    // Métodos para escrever os resultados como tabela, CSV ou JSON
+    void imprimirTabela(std::ostream& saida) const;
+    void escreverCSV(std::ostream& saida) const;
+    void escreverJSON(std::ostream& saida, const std::string& descricaoMaquina) const;
+
+private:
+    int aquecimento;
+    int repeticoes;
+    std::string filtro;
+    std::vector<ResultadoBench> resultados;
+    volatile long long sumidouro;
+};
+
+#endif // BENCHMARK_H
@@ -0,0 +1,308 @@
+#include "CorpusBinario.h"
+#include <cerrno>
+#include <cstring>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+using namespace std;
+
+namespace {
+
+const char MAGICA[8] = { 'S', 'D', 'K', 'C', 'O', 'R', 'P', '\0' };
+
+string mensagemErro(const string& operacao, const string& arquivo) {
+    return operacao + " " + arquivo + ": " + strerror(errno);
+}
+
+// A seção [offset, offset + bytes) fica entre o cabeçalho e o fim do arquivo.
+// Compara sem somar: offset e bytes vêm do arquivo e a soma poderia dar a volta.
+bool secaoCabe(uint64_t offset, uint64_t bytes, uint64_t tamanho) {
+    return offset >= sizeof(CabecalhoCorpus) && offset <= tamanho && bytes <= tamanho - offset;
+}
+
+} // namespace
+
+void empacotarTabuleiro(const Tabuleiro& tabuleiro, uint8_t registro[BYTES_POR_REGISTRO]) {
+    const uint8_t* c = tabuleiro.celulas;
+    for (int k = 0; k < NUM_CELULAS / 2; k++) {
+        registro[k] = static_cast<uint8_t>(c[2 * k] | (c[2 * k + 1] << 4));
+    }
+    registro[NUM_CELULAS / 2] = c[NUM_CELULAS - 1];
+}
+
+bool desempacotarTabuleiro(const uint8_t registro[BYTES_POR_REGISTRO], Tabuleiro& tabuleiro) {
+    uint8_t* c = tabuleiro.celulas;
+    int inicio = 0;
+    uint8_t invalido = 0;
+
+#ifdef __SSE2__
+    // Bytes 0-31 (células 0-63): separa os nibbles e intercala baixo/alto.
+    // Só lê dentro dos 41 bytes do registro (seguro no fim do mapeamento).
+    const __m128i nibble = _mm_set1_epi8(0x0F);
+    const __m128i nove = _mm_set1_epi8(9);
+    __m128i foraDaFaixa = _mm_setzero_si128();
+    for (int k = 0; k < 32; k += 16) {
+        __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(registro + k));
+        __m128i baixo = _mm_and_si128(bytes, nibble);
+        __m128i alto = _mm_and_si128(_mm_srli_epi16(bytes, 4), nibble);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(c + 2 * k), _mm_unpacklo_epi8(baixo, alto));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(c + 2 * k + 16), _mm_unpackhi_epi8(baixo, alto));
+        foraDaFaixa = _mm_or_si128(foraDaFaixa, _mm_or_si128(_mm_cmpgt_epi8(baixo, nove), _mm_cmpgt_epi8(alto, nove)));
+    }
+    invalido = static_cast<uint8_t>(_mm_movemask_epi8(foraDaFaixa) != 0);
+    inicio = 32;
+#endif
+
+    for (int k = inicio; k < NUM_CELULAS / 2; k++) {
+        uint8_t baixo = registro[k] & 0x0F;
+        uint8_t alto = registro[k] >> 4;
+        c[2 * k] = baixo;
+        c[2 * k + 1] = alto;
+        invalido |= static_cast<uint8_t>((baixo > 9) | (alto > 9));
+    }
+    c[NUM_CELULAS - 1] = registro[NUM_CELULAS / 2];
+    return invalido == 0 && registro[NUM_CELULAS / 2] <= 9;
+}
+
+// ---------------------------------------------------------------------------
+// Leitura
+
+// Construtor
+CorpusBinario::CorpusBinario()
+    : base(nullptr), tamanhoArquivo(0), numTabuleiros(0), puzzles(nullptr), solucoes(nullptr) {}
+
+// Destrutor - desfaz o mapeamento
+CorpusBinario::~CorpusBinario() {
+    fechar();
+}
+
+bool CorpusBinario::abrir(const string& arquivo) {
+    fechar();
+#ifdef _WIN32
+    erro = "leitura por mmap indisponível neste sistema";
+    return false;
+#else
+    int fd = open(arquivo.c_str(), O_RDONLY);
+    if (fd < 0) {
+        erro = mensagemErro("não foi possível abrir", arquivo);
+        return false;
+    }
+    struct stat info;
+    if (fstat(fd, &info) != 0) {
+        erro = mensagemErro("não foi possível consultar", arquivo);
+        close(fd);
+        return false;
+    }
+    size_t tamanho = static_cast<size_t>(info.st_size);
+    if (tamanho < sizeof(CabecalhoCorpus)) {
+        erro = arquivo + ": arquivo menor que o cabeçalho";
+        close(fd);
+        return false;
+    }
+
+    void* mapa = mmap(nullptr, tamanho, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);   // o mapeamento continua válido sem o descritor
+    if (mapa == MAP_FAILED) {
+        erro = mensagemErro("não foi possível mapear", arquivo);
+        return false;
+    }
+    // A leitura típica é sequencial (validação e solver em lote)
+    madvise(mapa, tamanho, MADV_SEQUENTIAL);
+
+    base = static_cast<const uint8_t*>(mapa);
+    tamanhoArquivo = tamanho;
+
+    // Conferir o cabeçalho e se as seções cabem no arquivo
+    CabecalhoCorpus cab;
+    memcpy(&cab, base, sizeof(cab));
+    uint64_t bytesSecao = cab.numTabuleiros * BYTES_POR_REGISTRO;
+    bool comSolucoes = (cab.flags & CabecalhoCorpus::FLAG_SOLUCOES) != 0;
+    if (memcmp(cab.magica, MAGICA, sizeof(MAGICA)) != 0) {
+        erro = arquivo + ": não é um corpus binário de sudoku";
+    } else if (cab.versao != CabecalhoCorpus::VERSAO) {
+        erro = arquivo + ": versão " + to_string(cab.versao) + " não suportada";
+    } else if (cab.ladoTabuleiro != LADO_TABULEIRO || cab.bytesPorRegistro != BYTES_POR_REGISTRO) {
+        erro = arquivo + ": só tabuleiros 9x9 com registros de 41 bytes são suportados";
+    } else if (cab.numTabuleiros > tamanho / BYTES_POR_REGISTRO ||
+               !secaoCabe(cab.offsetPuzzles, bytesSecao, tamanho) ||
+               (comSolucoes && !secaoCabe(cab.offsetSolucoes, bytesSecao, tamanho))) {
+        erro = arquivo + ": seções fora do arquivo (corpus truncado?)";
+    } else if (comSolucoes && cab.offsetSolucoes < cab.offsetPuzzles + bytesSecao &&
+               cab.offsetPuzzles < cab.offsetSolucoes + bytesSecao) {
+        // As duas seções já cabem no arquivo, então as somas não dão a volta
+        erro = arquivo + ": seções de puzzles e soluções sobrepostas";
+    } else {
+        numTabuleiros = static_cast<size_t>(cab.numTabuleiros);
+        puzzles = base + cab.offsetPuzzles;
+        solucoes = comSolucoes ? base + cab.offsetSolucoes : nullptr;
+        erro.clear();
+        return true;
+    }
+    string motivo = erro;
+    fechar();
+    erro = motivo;
+    return false;
+#endif
+}
+
+void CorpusBinario::fechar() {
+#ifndef _WIN32
+    if (base) {
+        munmap(const_cast<uint8_t*>(base), tamanhoArquivo);
+    }
+#endif
+    base = nullptr;
+    tamanhoArquivo = 0;
+    numTabuleiros = 0;
+    puzzles = nullptr;
+    solucoes = nullptr;
+}
+
+// ---------------------------------------------------------------------------
+// Escrita
+
+// Construtor
+EscritorCorpus::EscritorCorpus()
+    : descritor(-1), base(nullptr), capacidade(0), numTabuleiros(0), comSolucoes(false) {}
+
+// Destrutor - chama fechar() se o arquivo ainda estiver aberto
+EscritorCorpus::~EscritorCorpus() {
+    fechar();
+}
+
+size_t EscritorCorpus::bytesParaCapacidade(size_t cap) const {
+    return sizeof(CabecalhoCorpus) + cap * BYTES_POR_REGISTRO * (comSolucoes ? 2 : 1);
+}
+
+bool EscritorCorpus::criar(const string& arquivo, bool comSolucoes, size_t capacidadeInicial) {
+    fechar();
+    this->comSolucoes = comSolucoes;
+    numTabuleiros = 0;
+    capacidade = 0;
+#ifdef _WIN32
+    erro = "escrita por mmap indisponível neste sistema";
+    return false;
+#else
+    descritor = open(arquivo.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if (descritor < 0) {
+        erro = mensagemErro("não foi possível criar", arquivo);
+        return false;
+    }
+    if (!mapear(capacidadeInicial > 0 ? capacidadeInicial : 1)) {
+        close(descritor);
+        descritor = -1;
+        return false;
+    }
+    erro.clear();
+    return true;
+#endif
+}
+
+// Aumenta o arquivo para 'cap' tabuleiros e refaz o mapeamento, deslocando a
+// seção de soluções para o novo fim da seção de quebra-cabeças
+bool EscritorCorpus::mapear(size_t cap) {
+#ifdef _WIN32
+    return false;
+#else
+    size_t novoTamanho = bytesParaCapacidade(cap);
+    if (ftruncate(descritor, static_cast<off_t>(novoTamanho)) != 0) {
+        erro = mensagemErro("não foi possível aumentar", "o corpus");
+        return false;
+    }
+    if (base) {
+        munmap(base, bytesParaCapacidade(capacidade));
+    }
+    void* mapa = mmap(nullptr, novoTamanho, PROT_READ | PROT_WRITE, MAP_SHARED, descritor, 0);
+    if (mapa == MAP_FAILED) {
+        base = nullptr;
+        erro = mensagemErro("não foi possível mapear", "o corpus");
+        return false;
+    }
+    base = static_cast<uint8_t*>(mapa);
+
+    if (comSolucoes && numTabuleiros > 0) {
+        uint8_t* secao = base + sizeof(CabecalhoCorpus);
+        memmove(secao + cap * BYTES_POR_REGISTRO, secao + capacidade * BYTES_POR_REGISTRO,
+                numTabuleiros * BYTES_POR_REGISTRO);
+    }
+    capacidade = cap;
+    return true;
+#endif
+}
+
+bool EscritorCorpus::adicionar(const Tabuleiro& puzzle, const Tabuleiro* solucao) {
+    if (!base) {
+        return false;
+    }
+    if (comSolucoes && !solucao) {
+        erro = "o corpus tem seção de soluções: cada tabuleiro precisa da sua";
+        return false;
+    }
+    if (numTabuleiros == capacidade && !mapear(capacidade * 2)) {
+        return false;
+    }
+
+    uint8_t* secao = base + sizeof(CabecalhoCorpus);
+    empacotarTabuleiro(puzzle, secao + numTabuleiros * BYTES_POR_REGISTRO);
+    if (comSolucoes) {
+        empacotarTabuleiro(*solucao, secao + (capacidade + numTabuleiros) * BYTES_POR_REGISTRO);
+    }
+    numTabuleiros++;
+    return true;
+}
+
+bool EscritorCorpus::fechar() {
+#ifdef _WIN32
+    return false;
+#else
+    if (descritor < 0) {
+        return false;
+    }
+
+    bool ok = base != nullptr;
+    if (ok) {
+        // Encosta as soluções nos quebra-cabeças e grava o cabeçalho
+        uint8_t* secao = base + sizeof(CabecalhoCorpus);
+        if (comSolucoes) {
+            memmove(secao + numTabuleiros * BYTES_POR_REGISTRO, secao + capacidade * BYTES_POR_REGISTRO,
+                    numTabuleiros * BYTES_POR_REGISTRO);
+        }
+
+        CabecalhoCorpus cab;
+        memset(&cab, 0, sizeof(cab));
+        memcpy(cab.magica, MAGICA, sizeof(MAGICA));
+        cab.versao = CabecalhoCorpus::VERSAO;
+        cab.ladoTabuleiro = LADO_TABULEIRO;
+        cab.bytesPorRegistro = BYTES_POR_REGISTRO;
+        cab.flags = comSolucoes ? CabecalhoCorpus::FLAG_SOLUCOES : 0;
+        cab.numTabuleiros = numTabuleiros;
+        cab.offsetPuzzles = sizeof(CabecalhoCorpus);
+        cab.offsetSolucoes = comSolucoes ? sizeof(CabecalhoCorpus) + numTabuleiros * BYTES_POR_REGISTRO : 0;
+        memcpy(base, &cab, sizeof(cab));
+
+        munmap(base, bytesParaCapacidade(capacidade));
+        base = nullptr;
+
+        size_t final = sizeof(CabecalhoCorpus) + numTabuleiros * BYTES_POR_REGISTRO * (comSolucoes ? 2 : 1);
+        if (ftruncate(descritor, static_cast<off_t>(final)) != 0) {
+            erro = mensagemErro("não foi possível ajustar", "o corpus");
+            ok = false;
+        }
+    }
+    if (close(descritor) != 0 && ok) {
+        erro = mensagemErro("não foi possível fechar", "o corpus");
+        ok = false;
+    }
+    descritor = -1;
+    return ok;
+#endif
+}
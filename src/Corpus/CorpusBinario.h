@@ -0,0 +1,127 @@
+#ifndef CORPUSBINARIO_H
+#define CORPUSBINARIO_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include "../Tabuleiro/Tabuleiro.h"
+
+// Formato binário de corpus (.sdkc), em little-endian:
+//
+//   [cabeçalho de 64 bytes]
+//   [seção de quebra-cabeças: numTabuleiros registros de 41 bytes]
+//   [seção de soluções, opcional: numTabuleiros registros de 41 bytes]
+//
+// Cada registro guarda as 81 células em 4 bits (célula 2k no nibble baixo do
+// byte k, célula 2k+1 no alto; o último nibble fica zerado), metade do texto
+// de 82 bytes por linha e sem conversão de caracteres. O cabeçalho funciona
+// como índice de seções: guarda o deslocamento de cada seção no arquivo, e
+// como os registros têm tamanho fixo o tabuleiro i está em
+// offsetPuzzles + 41 * i, sem tabela por tabuleiro.
+const int BYTES_POR_REGISTRO = (NUM_CELULAS + 1) / 2;
+
+struct CabecalhoCorpus {
+    char magica[8];             // "SDKCORP\0"
+    uint32_t versao;
+    uint32_t ladoTabuleiro;     // 9
+    uint32_t bytesPorRegistro;  // 41
+    uint32_t flags;             // FLAG_SOLUCOES
+    uint64_t numTabuleiros;
+    uint64_t offsetPuzzles;
+    uint64_t offsetSolucoes;    // 0 se o corpus não tiver soluções
+    uint64_t reservado[2];
+
+    static const uint32_t VERSAO = 1;
+    static const uint32_t FLAG_SOLUCOES = 1;
+};
+
+static_assert(sizeof(CabecalhoCorpus) == 64, "Cabeçalho do corpus deve ter 64 bytes");
+
+// Método para empacotar 81 células (0-9) em um registro de 41 bytes
+void empacotarTabuleiro(const Tabuleiro& tabuleiro, uint8_t registro[BYTES_POR_REGISTRO]);
+
+// Método para desempacotar um registro; retorna false se alguma célula passar de 9
+bool desempacotarTabuleiro(const uint8_t registro[BYTES_POR_REGISTRO], Tabuleiro& tabuleiro);
+
+// Leitura de um corpus por mmap, sem cópia: os registros são lidos direto
+// das páginas mapeadas, com acesso aleatório por índice. Pode ser lido por
+// várias threads ao mesmo tempo.
+class CorpusBinario {
+public:
+    CorpusBinario();
+    ~CorpusBinario();
+
+    // Mapeia o arquivo e confere o cabeçalho; em caso de falha retorna false
+    // e getErro() descreve o motivo
+    bool abrir(const std::string& arquivo);
+    void fechar();
+
+    bool aberto() const { return base != nullptr; }
+    const std::string& getErro() const { return erro; }
+
+    size_t tamanho() const { return numTabuleiros; }
+    bool temSolucoes() const { return solucoes != nullptr; }
+
+    // Registros empacotados do tabuleiro i (ponteiros para dentro do mapeamento)
+    const uint8_t* registroPuzzle(size_t i) const { return puzzles + i * BYTES_POR_REGISTRO; }
+    const uint8_t* registroSolucao(size_t i) const { return solucoes + i * BYTES_POR_REGISTRO; }
+
+    // Desempacota o quebra-cabeça ou a solução i; false se o registro estiver corrompido
+    bool puzzle(size_t i, Tabuleiro& tabuleiro) const {
+        return desempacotarTabuleiro(registroPuzzle(i), tabuleiro);
+    }
+    bool solucao(size_t i, Tabuleiro& tabuleiro) const {
+        return desempacotarTabuleiro(registroSolucao(i), tabuleiro);
+    }
+
+private:
+    const uint8_t* base;
+    size_t tamanhoArquivo;
+    size_t numTabuleiros;
+    const uint8_t* puzzles;
+    const uint8_t* solucoes;
+    std::string erro;
+
+    CorpusBinario(const CorpusBinario&) = delete;
+    CorpusBinario& operator=(const CorpusBinario&) = delete;
+};
+
+// Escrita de um corpus por mmap, em fluxo (o número de tabuleiros não
+// precisa ser conhecido). O arquivo cresce dobrando de capacidade; a seção de
+// soluções é deslocada a cada crescimento e encostada na de quebra-cabeças em
+// fechar(), que também grava o cabeçalho e ajusta o tamanho final do arquivo.
+class EscritorCorpus {
+public:
+    EscritorCorpus();
+
+    // Destrutor - chama fechar() se o arquivo ainda estiver aberto
+    ~EscritorCorpus();
+
+    // Cria (ou trunca) o arquivo; retorna false e preenche getErro() em caso de falha
+    bool criar(const std::string& arquivo, bool comSolucoes, size_t capacidadeInicial = 4096);
+
+    // Acrescenta um tabuleiro (e sua solução, se o corpus tiver soluções)
+    bool adicionar(const Tabuleiro& puzzle, const Tabuleiro* solucao = nullptr);
+
+    // Grava o cabeçalho, ajusta o tamanho do arquivo e desfaz o mapeamento
+    bool fechar();
+
+    size_t tamanho() const { return numTabuleiros; }
+    const std::string& getErro() const { return erro; }
+
+private:
+    int descritor;
+    uint8_t* base;
+    size_t capacidade;
+    size_t numTabuleiros;
+    bool comSolucoes;
+    std::string erro;
+
+    size_t bytesParaCapacidade(size_t cap) const;
+    bool mapear(size_t cap);
+
+    EscritorCorpus(const EscritorCorpus&) = delete;
+    EscritorCorpus& operator=(const EscritorCorpus&) = delete;
+};
+
+#endif // CORPUSBINARIO_H
@@ -0,0 +1,304 @@
+#include "ProcessadorFluxo.h"
+#include <cstring>
+#include <deque>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include "../Gerador/GeradorPuzzles.h"
+#include "../Solver/ContadorSolucoes.h"
+#include "../Solver/SolverPropagacao.h"
+#include "../Validador/ValidadorMascara.h"
+#include "../Trace/Rastreador.h"
+
+using namespace std;
+
+namespace {
+
+// Linhas de entrada de um bloco, com o número de cada uma para as mensagens de erro
+struct BlocoEntrada {
+    vector<string> linhas;
+    vector<long long> numeros;
+};
+
+// Texto de saída de um bloco, já formatado, e suas contagens
+struct BlocoSaida {
+    string texto;
+    long long tabuleiros;
+    long long erros;
+    long long divergencias;
+
+    BlocoSaida() : tabuleiros(0), erros(0), divergencias(0) {}
+};
+
+// Remove espaços e '\r' do fim da linha (arquivos gerados no Windows)
+void aparar(string& linha) {
+    size_t fim = linha.find_last_not_of(" \t\r");
+    linha.erase(fim == string::npos ? 0 : fim + 1);
+}
+
+const char* nomeResultado(ResultadoValidacao resultado) {
+    switch (resultado) {
+        case ResultadoValidacao::VALIDO:   return "valido";
+        case ResultadoValidacao::INVALIDO: return "invalido";
+        default:                           return "incompleto";
+    }
+}
+
+// Processa um tabuleiro já convertido e acrescenta a linha de resultado.
+// 'eco' são os 81 caracteres repetidos na saída de VALIDAR e CONTAR;
+// 'esperada', se não for nula, é a solução guardada no corpus.
+void processarTabuleiro(Tabuleiro& tabuleiro, const char* eco, const Tabuleiro* esperada,
+                        const ConfigFluxo& config, SolverPropagacao& solver, BlocoSaida& saida) {
+    char texto[82];
+    switch (config.operacao) {
+        case OperacaoFluxo::VALIDAR:
+            saida.texto.append(eco, 81);
+            saida.texto += ' ';
+            saida.texto += nomeResultado(validarComMascaras(tabuleiro.celulas).resultado);
+            break;
+        case OperacaoFluxo::RESOLVER: {
+            bool resolvido = solver.resolver(tabuleiro);
+            if (resolvido) {
+                tabuleiro.paraTexto(texto);
+                saida.texto.append(texto, 81);
+            } else {
+                saida.texto += "sem_solucao";
+            }
+            if (esperada && (!resolvido || memcmp(tabuleiro.celulas, esperada->celulas, NUM_CELULAS) != 0)) {
+                saida.texto += " diverge";
+                saida.divergencias++;
+            }
+            break;
+        }
+        case OperacaoFluxo::CONTAR:
+            saida.texto.append(eco, 81);
+            saida.texto += ' ';
+            saida.texto += to_string(contarSolucoes(tabuleiro, config.limiteContagem));
+            break;
+        default:
+            break;
+    }
+    saida.texto += '\n';
+}
+
+// Processa um bloco de linhas de texto (executado por um trabalhador do pool)
+BlocoSaida processarBloco(const BlocoEntrada& bloco, const ConfigFluxo& config) {
+    RASTREAR("processar bloco", "fluxo");
+    BlocoSaida saida;
+    saida.texto.reserve(bloco.linhas.size() * 96);
+
+    SolverPropagacao solver;
+    Tabuleiro tabuleiro;
+    for (size_t i = 0; i < bloco.linhas.size(); i++) {
+        const string& linha = bloco.linhas[i];
+        saida.tabuleiros++;
+        if (linha.size() != 81 || !tabuleiro.carregarTexto(linha.c_str())) {
+            saida.erros++;
+            saida.texto += "erro: linha " + to_string(bloco.numeros[i]) +
+                           ": esperados 81 caracteres entre '1'-'9', '.' ou '0'\n";
+            continue;
+        }
+        processarTabuleiro(tabuleiro, linha.c_str(), nullptr, config, solver, saida);
+    }
+    return saida;
+}
+
+// Processa os tabuleiros [inicio, fim) de um corpus binário, lidos direto do mapeamento
+BlocoSaida processarFaixaCorpus(const CorpusBinario& corpus, size_t inicio, size_t fim,
+                                const ConfigFluxo& config) {
+    RASTREAR("processar faixa do corpus", "fluxo");
+    BlocoSaida saida;
+    saida.texto.reserve((fim - inicio) * 96);
+
+    SolverPropagacao solver;
+    Tabuleiro tabuleiro, esperada;
+    char eco[82];
+    bool comparar = config.operacao == OperacaoFluxo::RESOLVER && corpus.temSolucoes();
+    for (size_t i = inicio; i < fim; i++) {
+        saida.tabuleiros++;
+        if (!corpus.puzzle(i, tabuleiro) || (comparar && !corpus.solucao(i, esperada))) {
+            saida.erros++;
+            saida.texto += "erro: tabuleiro " + to_string(i) + ": registro corrompido\n";
+            continue;
+        }
+        tabuleiro.paraTexto(eco);
+        processarTabuleiro(tabuleiro, eco, comparar ? &esperada : nullptr, config, solver, saida);
+    }
+    return saida;
+}
+
+// Gera 'quantidade' quebra-cabeças a partir de um fluxo xoshiro próprio do bloco
+BlocoSaida gerarBloco(Xoshiro256 fluxo, int quantidade, int alvoPistas) {
+    RASTREAR("gerar bloco", "fluxo");
+    BlocoSaida saida;
+    saida.texto.reserve(static_cast<size_t>(quantidade) * 82);
+
+    GeradorPuzzles gerador(fluxo);
+    char texto[82];
+    for (int i = 0; i < quantidade; i++) {
+        gerador.gerar(alvoPistas).paraTexto(texto);
+        saida.texto.append(texto, 81);
+        saida.texto += '\n';
+    }
+    saida.tabuleiros = quantidade;
+    return saida;
+}
+
+// Escreve o bloco mais antigo da janela (esperando por ele) e soma os totais
+void escreverMaisAntigo(deque<future<BlocoSaida> >& janela, ostream& saida, ResumoFluxo& resumo) {
+    BlocoSaida bloco = janela.front().get();
+    janela.pop_front();
+    saida.write(bloco.texto.data(), static_cast<streamsize>(bloco.texto.size()));
+    resumo.tabuleiros += bloco.tabuleiros;
+    resumo.erros += bloco.erros;
+    resumo.divergencias += bloco.divergencias;
+}
+
+} // namespace
+
+bool lerOperacaoFluxo(const char* texto, OperacaoFluxo& operacao) {
+    if (strcmp(texto, "validar") == 0) {
+        operacao = OperacaoFluxo::VALIDAR;
+    } else if (strcmp(texto, "resolver") == 0) {
+        operacao = OperacaoFluxo::RESOLVER;
+    } else if (strcmp(texto, "contar") == 0) {
+        operacao = OperacaoFluxo::CONTAR;
+    } else if (strcmp(texto, "gerar") == 0) {
+        operacao = OperacaoFluxo::GERAR;
+    } else {
+        return false;
+    }
+    return true;
+}
+
+// Construtor
+ProcessadorFluxo::ProcessadorFluxo(const ConfigFluxo& config, shared_ptr<ThreadPool> pool)
+    : config(config), pool(pool) {
+    if (this->config.linhasPorBloco < 1) {
+        this->config.linhasPorBloco = 1;
+    }
+    if (this->config.blocosEmVoo < 1) {
+        this->config.blocosEmVoo = 4 * static_cast<int>(pool->numThreads());
+    }
+}
+
+ResumoFluxo ProcessadorFluxo::executar(istream& entrada, ostream& saida) {
+    RASTREAR("ProcessadorFluxo::executar", "fluxo");
+    auto inicio = chrono::steady_clock::now();
+
+    ResumoFluxo resumo = config.operacao == OperacaoFluxo::GERAR ? gerar(saida)
+                                                                  : processarEntrada(entrada, saida);
+    saida.flush();
+    resumo.tempo = chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now() - inicio);
+    return resumo;
+}
+
+ResumoFluxo ProcessadorFluxo::executar(const CorpusBinario& corpus, ostream& saida) {
+    RASTREAR("ProcessadorFluxo::executar(corpus)", "fluxo");
+    auto inicio = chrono::steady_clock::now();
+
+    ResumoFluxo resumo;
+    deque<future<BlocoSaida> > janela;
+    ThreadPool::Lote lote(*pool);
+    const ConfigFluxo* cfg = &config;
+    const CorpusBinario* c = &corpus;
+
+    // Sem leitura nem conversão de texto: cada tarefa recebe uma faixa de índices
+    for (size_t ini = 0; ini < corpus.tamanho(); ini += config.linhasPorBloco) {
+        size_t fim = min(corpus.tamanho(), ini + static_cast<size_t>(config.linhasPorBloco));
+        janela.push_back(lote.enviar([c, ini, fim, cfg]() { return processarFaixaCorpus(*c, ini, fim, *cfg); }));
+        while (static_cast<int>(janela.size()) >= config.blocosEmVoo) {
+            escreverMaisAntigo(janela, saida, resumo);
+        }
+    }
+
+    while (!janela.empty()) {
+        escreverMaisAntigo(janela, saida, resumo);
+    }
+    saida.flush();
+    resumo.tempo = chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now() - inicio);
+    return resumo;
+}
+
+ResumoFluxo ProcessadorFluxo::processarEntrada(istream& entrada, ostream& saida) {
+    ResumoFluxo resumo;
+    deque<future<BlocoSaida> > janela;
+    ThreadPool::Lote lote(*pool);
+    const ConfigFluxo* cfg = &config;
+
+    string linha;
+    long long numeroLinha = 0;
+    bool fim = false;
+    while (!fim) {
+        // Lê o próximo bloco enquanto os anteriores são processados
+        shared_ptr<BlocoEntrada> bloco = make_shared<BlocoEntrada>();
+        bloco->linhas.reserve(config.linhasPorBloco);
+        bloco->numeros.reserve(config.linhasPorBloco);
+        while (static_cast<int>(bloco->linhas.size()) < config.linhasPorBloco) {
+            if (!getline(entrada, linha)) {
+                fim = true;
+                break;
+            }
+            numeroLinha++;
+            aparar(linha);
+            if (linha.empty() || linha[0] == '#') {
+                continue;
+            }
+            bloco->linhas.push_back(linha);
+            bloco->numeros.push_back(numeroLinha);
+        }
+
+        if (!bloco->linhas.empty()) {
+            janela.push_back(lote.enviar([bloco, cfg]() { return processarBloco(*bloco, *cfg); }));
+        }
+        // Janela cheia: a leitura espera pela escrita do bloco mais antigo
+        while (static_cast<int>(janela.size()) >= config.blocosEmVoo) {
+            escreverMaisAntigo(janela, saida, resumo);
+        }
+    }
+
+    while (!janela.empty()) {
+        escreverMaisAntigo(janela, saida, resumo);
+    }
+    return resumo;
+}
+
+ResumoFluxo ProcessadorFluxo::gerar(ostream& saida) {
+    ResumoFluxo resumo;
+    deque<future<BlocoSaida> > janela;
+    ThreadPool::Lote lote(*pool);
+
+    // Cada bloco recebe o próximo salto do fluxo mestre: a saída depende só
+    // da semente e do tamanho do bloco, não do número de threads
+    Xoshiro256 fluxo(config.semente);
+    int alvo = pistasAlvo(config.nivel);
+    for (long long gerados = 0; gerados < config.quantidade; ) {
+        int quantidade = static_cast<int>(min<long long>(config.linhasPorBloco, config.quantidade - gerados));
+        janela.push_back(lote.enviar([fluxo, quantidade, alvo]() { return gerarBloco(fluxo, quantidade, alvo); }));
+        fluxo.saltar();
+        gerados += quantidade;
+
+        while (static_cast<int>(janela.size()) >= config.blocosEmVoo) {
+            escreverMaisAntigo(janela, saida, resumo);
+        }
+    }
+
+    while (!janela.empty()) {
+        escreverMaisAntigo(janela, saida, resumo);
+    }
+    return resumo;
+}
+
+void ProcessadorFluxo::imprimirResumo(ostream& saida, const ResumoFluxo& resumo) {
+    double segundos = resumo.tempo.count() / 1e9;
+    saida << resumo.tabuleiros << " tabuleiros em " << fixed << setprecision(3)
+          << resumo.tempo.count() / 1e6 << " ms (" << setprecision(1)
+          << (segundos > 0 ? resumo.tabuleiros / segundos : 0.0) << " tabuleiros/s)";
+    if (resumo.erros > 0) {
+        saida << ", " << resumo.erros << " linhas com erro";
+    }
+    if (resumo.divergencias > 0) {
+        saida << ", " << resumo.divergencias << " soluções divergentes do corpus";
+    }
+    saida << endl;
+}
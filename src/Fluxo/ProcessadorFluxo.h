@@ -0,0 +1,86 @@
+#ifndef PROCESSADORFLUXO_H
+#define PROCESSADORFLUXO_H
+
+#include <cstdint>
+#include <chrono>
+#include <istream>
+#include <memory>
+#include <ostream>
+#include "../Corpus/CorpusBinario.h"
+#include "../Gerador/Dificuldade.h"
+#include "../ThreadPool/ThreadPool.h"
+
+// Operação aplicada a cada tabuleiro do fluxo
+enum class OperacaoFluxo {
+    VALIDAR,    // "<tabuleiro> valido|invalido|incompleto"
+    RESOLVER,   // solução em 81 caracteres, ou "sem_solucao"
+    CONTAR,     // "<tabuleiro> <soluções>", contando até o limite
+    GERAR       // quebra-cabeças novos com solução única (sem entrada)
+};
+
+// Converte "validar", "resolver", "contar" ou "gerar"; retorna false se não reconhecer
+bool lerOperacaoFluxo(const char* texto, OperacaoFluxo& operacao);
+
+// Parâmetros do processamento em fluxo
+struct ConfigFluxo {
+    OperacaoFluxo operacao;
+    int limiteContagem;        // CONTAR: para de contar ao atingir o limite
+    long long quantidade;      // GERAR: número de quebra-cabeças
+    Dificuldade nivel;         // GERAR
+    uint64_t semente;          // GERAR
+    int linhasPorBloco;        // tabuleiros por tarefa do pool
+    int blocosEmVoo;           // blocos lidos à frente da saída (0 = 4 por thread do pool)
+
+    ConfigFluxo()
+        : operacao(OperacaoFluxo::VALIDAR), limiteContagem(2), quantidade(0),
+          nivel(Dificuldade::MEDIO), semente(1), linhasPorBloco(256), blocosEmVoo(0) {}
+};
+
+// Totais de uma execução
+struct ResumoFluxo {
+    long long tabuleiros;      // linhas processadas (ou quebra-cabeças gerados)
+    long long erros;           // linhas com formato inválido (ou registros corrompidos)
+    long long divergencias;    // RESOLVER sobre corpus com soluções: resultados diferentes dos guardados
+    std::chrono::nanoseconds tempo;
+
+    ResumoFluxo() : tabuleiros(0), erros(0), divergencias(0), tempo(0) {}
+};
+
+// Processamento não interativo de tabuleiros no formato de 81 caracteres por
+// linha ('1'-'9', '.' ou '0' para vazio). Linhas vazias e começadas por '#'
+// são ignoradas; as demais produzem exatamente uma linha de saída, na ordem
+// da entrada, e uma linha mal formada vira "erro: linha N: ...".
+//
+// A thread chamadora lê a entrada em blocos de linhas e os envia ao pool;
+// cada bloco é convertido e processado por um trabalhador, que devolve o
+// texto de saída já formatado. A chamadora mantém até 'blocosEmVoo' blocos
+// pendentes e escreve o mais antigo assim que ele termina, de modo que
+// leitura, processamento e escrita se sobrepõem sem perder a ordem e com
+// memória limitada, independentemente do tamanho da entrada.
+class ProcessadorFluxo {
+public:
+    explicit ProcessadorFluxo(const ConfigFluxo& config,
+                              std::shared_ptr<ThreadPool> pool = ThreadPool::compartilhado());
+
+    // Lê tabuleiros de 'entrada' e escreve os resultados em 'saida'.
+    // Para GERAR a entrada não é lida.
+    ResumoFluxo executar(std::istream& entrada, std::ostream& saida);
+
+    // Processa um corpus binário mapeado (VALIDAR, RESOLVER ou CONTAR) sem
+    // conversão de texto: cada tarefa lê uma faixa de registros direto do
+    // mapeamento. Em RESOLVER, se o corpus tiver soluções, cada resultado é
+    // comparado com a solução guardada e as diferenças saem como "diverge".
+    ResumoFluxo executar(const CorpusBinario& corpus, std::ostream& saida);
+
+    // Método para imprimir os totais (tabuleiros, erros, vazão)
+    static void imprimirResumo(std::ostream& saida, const ResumoFluxo& resumo);
+
+private:
+    ConfigFluxo config;
+    std::shared_ptr<ThreadPool> pool;
+
+    ResumoFluxo processarEntrada(std::istream& entrada, std::ostream& saida);
+    ResumoFluxo gerar(std::ostream& saida);
+};
+
+#endif // PROCESSADORFLUXO_H
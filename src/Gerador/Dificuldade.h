@@ -0,0 +1,38 @@
+#ifndef DIFICULDADE_H
+#define DIFICULDADE_H
+
+// Enum para os níveis de dificuldade
+// (MEDIO e DIFICIL ficam no mínimo de pistas que ainda garante solução única)
+enum class Dificuldade {
+    FACIL,   // ~50% preenchido
+    MEDIO,   // ~20% preenchido
+    DIFICIL  // ~10% preenchido
+};
+
+// Número de pistas que o gerador tenta manter em cada nível
+// (totalCelulas: 81 no 9x9, N*N nas variantes maiores)
+inline int pistasAlvo(Dificuldade nivel, int totalCelulas = 9 * 9) {
+    switch (nivel) {
+        case Dificuldade::FACIL:
+            // Manter ~50% preenchido, remover ~50%
+            return totalCelulas - static_cast<int>(totalCelulas * 0.5);
+        case Dificuldade::MEDIO:
+            // Manter ~20% preenchido, remover ~80%
+            return totalCelulas - static_cast<int>(totalCelulas * 0.8);
+        case Dificuldade::DIFICIL:
+        default:
+            // Manter ~10% preenchido, remover ~90%
+            return totalCelulas - static_cast<int>(totalCelulas * 0.9);
+    }
+}
+
+// Nome legível do nível
+inline const char* nomeDificuldade(Dificuldade nivel) {
+    switch (nivel) {
+        case Dificuldade::FACIL: return "FACIL";
+        case Dificuldade::MEDIO: return "MEDIO";
+        default:                 return "DIFICIL";
+    }
+}
+
+#endif // DIFICULDADE_H
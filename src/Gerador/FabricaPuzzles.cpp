@@ -0,0 +1,90 @@
+#include "FabricaPuzzles.h"
+#include "GeradorPuzzles.h"
+#include "Xoshiro.h"
+#include <iomanip>
+#include "../Trace/Rastreador.h"
+
+using namespace std;
+
+// Construtor
+FabricaPuzzles::FabricaPuzzles(uint64_t sementeMestre, unsigned numTrabalhadores)
+    : sementeMestre(sementeMestre), numTrabalhadores(numTrabalhadores), numChamadas(0),
+      pool(ThreadPool::compartilhado()) {
+    if (this->numTrabalhadores == 0) {
+        this->numTrabalhadores = pool->numThreads();
+    }
+    for (int d = 0; d < 3; d++) {
+        gerados[d] = 0;
+        tempo[d] = chrono::nanoseconds(0);
+    }
+}
+
+vector<PuzzleGerado> FabricaPuzzles::gerar(int quantidade, Dificuldade nivel) {
+    RASTREAR("FabricaPuzzles::gerar", "gerador");
+    vector<PuzzleGerado> saida(quantidade > 0 ? quantidade : 0);
+    if (quantidade <= 0) {
+        return saida;
+    }
+
+    auto inicio = chrono::high_resolution_clock::now();
+
+    // Cada chamada parte de uma semente derivada da mestre, para que gerar()
+    // repetido não devolva os mesmos quebra-cabeças
+    Xoshiro256 fluxo(sementeMestre + numChamadas++ * 0x9E3779B97F4A7C15ULL);
+    int alvo = pistasAlvo(nivel);
+
+    {
+        ThreadPool::Lote lote(*pool);
+        for (unsigned w = 0; w < numTrabalhadores; w++) {
+            // Faixa contígua [ini, fim) fixa para o trabalhador w
+            int ini = static_cast<int>(static_cast<long long>(quantidade) * w / numTrabalhadores);
+            int fim = static_cast<int>(static_cast<long long>(quantidade) * (w + 1) / numTrabalhadores);
+            if (ini < fim) {
+                PuzzleGerado* destino = saida.data();
+                lote.enviar([fluxo, destino, ini, fim, alvo]() {
+                    RASTREAR("faixa do trabalhador", "gerador");
+                    GeradorPuzzles gerador(fluxo);
+                    for (int i = ini; i < fim; i++) {
+                        destino[i].puzzle = gerador.gerar(alvo, &destino[i].solucao);
+                    }
+                });
+            }
+            fluxo.saltar();
+        }
+        lote.aguardar();
+    }
+
+    int d = static_cast<int>(nivel);
+    gerados[d] += quantidade;
+    tempo[d] += chrono::duration_cast<chrono::nanoseconds>(
+        chrono::high_resolution_clock::now() - inicio);
+    return saida;
+}
+
+long long FabricaPuzzles::getNumGerados(Dificuldade nivel) const {
+    return gerados[static_cast<int>(nivel)];
+}
+
+chrono::nanoseconds FabricaPuzzles::getTempo(Dificuldade nivel) const {
+    return tempo[static_cast<int>(nivel)];
+}
+
+double FabricaPuzzles::puzzlesPorSegundo(Dificuldade nivel) const {
+    long long ns = tempo[static_cast<int>(nivel)].count();
+    if (ns == 0) {
+        return 0.0;
+    }
+    return gerados[static_cast<int>(nivel)] * 1e9 / ns;
+}
+
+void FabricaPuzzles::imprimirRelatorio(ostream& saida) const {
+    saida << "=== FÁBRICA DE QUEBRA-CABEÇAS (" << numTrabalhadores << " trabalhadores) ===" << endl;
+    const Dificuldade niveis[3] = { Dificuldade::FACIL, Dificuldade::MEDIO, Dificuldade::DIFICIL };
+    for (Dificuldade nivel : niveis) {
+        if (getNumGerados(nivel) == 0) continue;
+        saida << setw(8) << left << nomeDificuldade(nivel) << right
+              << setw(8) << getNumGerados(nivel) << " puzzles em "
+              << fixed << setprecision(3) << getTempo(nivel).count() / 1e6 << " ms  ("
+              << setprecision(1) << puzzlesPorSegundo(nivel) << " puzzles/s)" << endl;
+    }
+}
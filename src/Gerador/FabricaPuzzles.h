@@ -0,0 +1,53 @@
+#ifndef FABRICAPUZZLES_H
+#define FABRICAPUZZLES_H
+
+#include <cstdint>
+#include <chrono>
+#include <memory>
+#include <ostream>
+#include <vector>
+#include "../Tabuleiro/Tabuleiro.h"
+#include "../ThreadPool/ThreadPool.h"
+#include "Dificuldade.h"
+
+// Quebra-cabeça gerado pela fábrica, junto com a sua solução única
+struct PuzzleGerado {
+    Tabuleiro puzzle;
+    Tabuleiro solucao;
+};
+
+// Fábrica de quebra-cabeças em paralelo.
+// Cada trabalhador recebe um fluxo xoshiro próprio, obtido saltando a semente
+// mestre w vezes, e gera uma faixa contígua fixa dos índices pedidos. Assim a
+// saída depende apenas da semente e do número de trabalhadores, e não da ordem
+// em que o pool executa as tarefas.
+class FabricaPuzzles {
+public:
+    // numTrabalhadores == 0 usa o número de threads do pool compartilhado
+    explicit FabricaPuzzles(uint64_t sementeMestre, unsigned numTrabalhadores = 0);
+
+    // Gera 'quantidade' quebra-cabeças do nível pedido, na ordem dos índices
+    std::vector<PuzzleGerado> gerar(int quantidade, Dificuldade nivel);
+
+    // Número de trabalhadores (e de fluxos aleatórios) usados por gerar()
+    unsigned getNumTrabalhadores() const { return numTrabalhadores; }
+
+    // Quebra-cabeças gerados e tempo gasto em cada nível desde a criação
+    long long getNumGerados(Dificuldade nivel) const;
+    std::chrono::nanoseconds getTempo(Dificuldade nivel) const;
+    double puzzlesPorSegundo(Dificuldade nivel) const;
+
+    // Método para imprimir a vazão por nível de dificuldade
+    void imprimirRelatorio(std::ostream& saida) const;
+
+private:
+    uint64_t sementeMestre;
+    unsigned numTrabalhadores;
+    uint64_t numChamadas;
+    std::shared_ptr<ThreadPool> pool;
+
+    long long gerados[3];
+    std::chrono::nanoseconds tempo[3];
+};
+
+#endif // FABRICAPUZZLES_H
@@ -0,0 +1,120 @@
+#include "GeradorN.h"
+#include "../Solver/SolverN.h"
+
+using namespace std;
+
+// Construtor
+template <int B>
+GeradorPuzzlesN<B>::GeradorPuzzlesN(uint64_t semente) : rng(semente), numContagens(0) {}
+
+template <int B>
+TabuleiroN<B> GeradorPuzzlesN<B>::gerarSolucao() {
+    typedef TabuleiroN<B> T;
+    const int N = T::LADO;
+
+    // Primeiro a busca aleatória a partir do tabuleiro vazio, que dá soluções
+    // sem estrutura; até 36x36 ela termina com poucos retrocessos
+    SolverPropagacaoN<B> solver;
+    solver.setAleatorio(true, rng());
+    solver.setLimiteNos(LIMITE_NOS_POR_CELULA * T::NUM_CELULAS);
+    T solucao;
+    solucao.limpar();
+    if (solver.resolver(solucao)) {
+        return solucao;
+    }
+
+    // Permutações de dígitos, de linhas/colunas dentro de cada faixa/pilha e das faixas/pilhas
+    int digitos[N], faixas[B], pilhas[B], linhas[N], colunas[N];
+    for (int d = 0; d < N; d++) {
+        digitos[d] = d + 1;
+    }
+    for (int k = 0; k < B; k++) {
+        faixas[k] = k;
+        pilhas[k] = k;
+    }
+    rng.embaralhar(digitos, N);
+    rng.embaralhar(faixas, B);
+    rng.embaralhar(pilhas, B);
+
+    for (int k = 0; k < B; k++) {
+        int dentroLinha[B], dentroColuna[B];
+        for (int j = 0; j < B; j++) {
+            dentroLinha[j] = j;
+            dentroColuna[j] = j;
+        }
+        rng.embaralhar(dentroLinha, B);
+        rng.embaralhar(dentroColuna, B);
+        for (int j = 0; j < B; j++) {
+            linhas[k * B + j] = faixas[k] * B + dentroLinha[j];
+            colunas[k * B + j] = pilhas[k] * B + dentroColuna[j];
+        }
+    }
+
+    for (int r = 0; r < N; r++) {
+        int linha = linhas[r];
+        for (int c = 0; c < N; c++) {
+            int coluna = colunas[c];
+            int padrao = (B * (linha % B) + linha / B + coluna) % N;
+            solucao.celulas[r * N + c] = static_cast<uint8_t>(digitos[padrao]);
+        }
+    }
+    return solucao;
+}
+
+template <int B>
+TabuleiroN<B> GeradorPuzzlesN<B>::removerComUnicidade(const TabuleiroN<B>& solucao, int alvoPistas) {
+    typedef TabuleiroN<B> T;
+
+    T puzzle = solucao;
+    numContagens = 0;
+
+    int pistas = 0;
+    int posicoes[T::NUM_CELULAS];
+    int numPosicoes = 0;
+    for (int i = 0; i < T::NUM_CELULAS; i++) {
+        if (puzzle.celulas[i] != 0) {
+            posicoes[numPosicoes++] = i;
+            pistas++;
+        }
+    }
+    rng.embaralhar(posicoes, numPosicoes);
+
+    // Um único solver para todas as contagens: a pilha de estados é reaproveitada.
+    // Contagens que estouram o limite de nós contam como "não única": a pista fica,
+    // e o quebra-cabeça continua com solução única garantida.
+    SolverPropagacaoN<B> contador;
+    contador.setLimiteNos(LIMITE_NOS_CONTAGEM);
+
+    // Tirar pistas só aumenta o número de soluções, então uma célula recusada
+    // nunca precisa ser tentada de novo
+    for (int k = 0; k < numPosicoes && pistas > alvoPistas; k++) {
+        int indice = posicoes[k];
+        uint8_t valor = puzzle.celulas[indice];
+        puzzle.celulas[indice] = 0;
+
+        numContagens++;
+        if (contador.contarSolucoes(puzzle, 2) == 1 && !contador.foiInterrompido()) {
+            pistas--;
+        } else {
+            puzzle.celulas[indice] = valor;
+        }
+    }
+
+    return puzzle;
+}
+
+template <int B>
+TabuleiroN<B> GeradorPuzzlesN<B>::gerar(int alvoPistas, TabuleiroN<B>* solucao) {
+    TabuleiroN<B> completa = gerarSolucao();
+    if (solucao) {
+        *solucao = completa;
+    }
+    return removerComUnicidade(completa, alvoPistas);
+}
+
+// Instanciações explícitas dos tamanhos suportados
+template class GeradorPuzzlesN<3>;
+template class GeradorPuzzlesN<4>;
+template class GeradorPuzzlesN<5>;
+template class GeradorPuzzlesN<6>;
+template class GeradorPuzzlesN<8>;
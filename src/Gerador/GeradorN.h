@@ -0,0 +1,49 @@
+#ifndef GERADORN_H
+#define GERADORN_H
+
+#include <cstdint>
+#include "../Tabuleiro/TabuleiroN.h"
+#include "Xoshiro.h"
+
+// Gerador de quebra-cabeças N x N com solução única.
+// A solução completa vem do solver aleatório a partir do tabuleiro vazio. Se ele
+// estourar o limite de nós (às vezes no 64x64), o gerador usa o padrão canônico
+// (B * (linha % B) + linha / B + coluna) % N, embaralhado por simetrias que
+// preservam a validade: trocas de dígitos, de linhas dentro de uma faixa, de
+// faixas, de colunas dentro de uma pilha e de pilhas.
+// A remoção de pistas segue GeradorPuzzles: cada célula só sai se a solução
+// continuar única. Nos tamanhos grandes provar a unicidade pode explodir, então
+// cada contagem tem um limite de nós e, se ele estourar, a pista fica.
+template <int B>
+class GeradorPuzzlesN {
+public:
+    explicit GeradorPuzzlesN(uint64_t semente);
+
+    // Gera uma solução completa aleatória
+    TabuleiroN<B> gerarSolucao();
+
+    // Remove células de 'solucao' até restarem 'alvoPistas' pistas ou até
+    // nenhuma remoção manter a unicidade. Retorna o quebra-cabeça gerado.
+    TabuleiroN<B> removerComUnicidade(const TabuleiroN<B>& solucao, int alvoPistas);
+
+    // Gera um quebra-cabeça com solução única e cerca de 'alvoPistas' pistas.
+    // Se 'solucao' não for nulo, recebe a solução completa correspondente.
+    TabuleiroN<B> gerar(int alvoPistas, TabuleiroN<B>* solucao = nullptr);
+
+    // Número de chamadas ao contador de soluções na última geração
+    int getNumContagens() const { return numContagens; }
+
+private:
+    // Nós de busca permitidos por célula ao gerar a solução completa
+    static const int LIMITE_NOS_POR_CELULA = 2;
+
+    // Nós de busca permitidos em cada contagem de unicidade. As remoções aceitas
+    // quase sempre se provam únicas em poucas dezenas de nós; as que passam
+    // disso raramente terminam em "única" e dominariam o tempo de geração.
+    static const int LIMITE_NOS_CONTAGEM = 64;
+
+    Xoshiro256 rng;
+    int numContagens;
+};
+
+#endif // GERADORN_H
@@ -0,0 +1,69 @@
+#include "GeradorPuzzles.h"
+#include "../Solver/ContadorSolucoes.h"
+#include "../Solver/SolverPropagacao.h"
+#include "../Trace/Rastreador.h"
+
+using namespace std;
+
+// Construtor
+GeradorPuzzles::GeradorPuzzles(uint64_t semente) : rng(semente), numContagens(0) {}
+
+GeradorPuzzles::GeradorPuzzles(const Xoshiro256& fluxo) : rng(fluxo), numContagens(0) {}
+
+Tabuleiro GeradorPuzzles::gerarSolucao() {
+    RASTREAR("gerarSolucao", "gerador");
+
+    // O solver sorteia a ordem dos dígitos em cada ramificação; partindo do
+    // tabuleiro vazio, qualquer ordem leva a uma solução sem retrocessos longos
+    SolverPropagacao solver;
+    solver.setAleatorio(true, rng());
+
+    Tabuleiro solucao;
+    solucao.limpar();
+    solver.resolver(solucao);
+    return solucao;
+}
+
+Tabuleiro GeradorPuzzles::gerar(int alvoPistas, Tabuleiro* solucao) {
+    RASTREAR("GeradorPuzzles::gerar", "gerador");
+    Tabuleiro completa = gerarSolucao();
+    if (solucao) {
+        *solucao = completa;
+    }
+    return removerComUnicidade(completa, alvoPistas);
+}
+
+Tabuleiro GeradorPuzzles::removerComUnicidade(const Tabuleiro& solucao, int alvoPistas) {
+    RASTREAR("removerComUnicidade", "gerador");
+    Tabuleiro puzzle = solucao;
+    numContagens = 0;
+
+    int pistas = 0;
+    int posicoes[81];
+    int numPosicoes = 0;
+    for (int i = 0; i < 81; i++) {
+        if (puzzle.celulas[i] != 0) {
+            posicoes[numPosicoes++] = i;
+            pistas++;
+        }
+    }
+    rng.embaralhar(posicoes, numPosicoes);
+
+    // Remover uma célula por vez; desfazer se a solução deixar de ser única.
+    // Tirar pistas só aumenta o número de soluções, então uma célula recusada
+    // nunca precisa ser tentada de novo.
+    for (int k = 0; k < numPosicoes && pistas > alvoPistas; k++) {
+        int indice = posicoes[k];
+        uint8_t valor = puzzle.celulas[indice];
+        puzzle.celulas[indice] = 0;
+
+        numContagens++;
+        if (contarSolucoes(puzzle, 2) == 1) {
+            pistas--;
+        } else {
+            puzzle.celulas[indice] = valor;
+        }
+    }
+
+    return puzzle;
+}
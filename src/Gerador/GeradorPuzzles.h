@@ -0,0 +1,38 @@
+#ifndef GERADORPUZZLES_H
+#define GERADORPUZZLES_H
+
+#include <cstdint>
+#include "../Tabuleiro/Tabuleiro.h"
+#include "Xoshiro.h"
+
+// Gerador de quebra-cabeças com solução única.
+// Parte de uma solução completa e remove as células uma a uma, em ordem
+// aleatória; cada remoção só é mantida se o contador de soluções (que para
+// em 2) confirmar que o quebra-cabeça continua com uma única solução.
+class GeradorPuzzles {
+public:
+    explicit GeradorPuzzles(uint64_t semente);
+
+    // Cria o gerador a partir de um fluxo xoshiro já posicionado (ex.: após saltar())
+    explicit GeradorPuzzles(const Xoshiro256& fluxo);
+
+    // Gera uma solução completa aleatória com o solver por propagação
+    Tabuleiro gerarSolucao();
+
+    // Gera um quebra-cabeça com solução única e cerca de 'alvoPistas' pistas.
+    // Se 'solucao' não for nulo, recebe a solução completa correspondente.
+    Tabuleiro gerar(int alvoPistas, Tabuleiro* solucao = nullptr);
+
+    // Remove células de 'solucao' até restarem 'alvoPistas' pistas ou até
+    // nenhuma remoção manter a unicidade. Retorna o quebra-cabeça gerado.
+    Tabuleiro removerComUnicidade(const Tabuleiro& solucao, int alvoPistas);
+
+    // Número de chamadas ao contador de soluções na última geração
+    int getNumContagens() const { return numContagens; }
+
+private:
+    Xoshiro256 rng;
+    int numContagens;
+};
+
+#endif // GERADORPUZZLES_H
@@ -0,0 +1,88 @@
+#ifndef XOSHIRO_H
+#define XOSHIRO_H
+
+#include <cstdint>
+#include <limits>
+
+// Gerador pseudoaleatório xoshiro256** (Blackman & Vigna).
+// Rápido, sem chamadas de sistema e totalmente determinístico a partir da
+// semente; saltar() avança 2^128 passos, gerando fluxos independentes para
+// cada thread a partir de uma única semente mestre.
+// Satisfaz UniformRandomBitGenerator, então também funciona com <random>.
+class Xoshiro256 {
+public:
+    typedef uint64_t result_type;
+
+    explicit Xoshiro256(uint64_t semente = 0) { semear(semente); }
+
+    // Expande a semente de 64 bits para os 256 bits de estado com splitmix64
+    void semear(uint64_t semente) {
+        for (int i = 0; i < 4; i++) {
+            semente += 0x9E3779B97F4A7C15ULL;
+            uint64_t z = semente;
+            z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+            z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+            estado[i] = z ^ (z >> 31);
+        }
+    }
+
+    static constexpr result_type min() { return 0; }
+    static constexpr result_type max() { return std::numeric_limits<result_type>::max(); }
+
+    result_type operator()() {
+        uint64_t resultado = rotl(estado[1] * 5, 7) * 9;
+        uint64_t t = estado[1] << 17;
+        estado[2] ^= estado[0];
+        estado[3] ^= estado[1];
+        estado[1] ^= estado[2];
+        estado[0] ^= estado[3];
+        estado[2] ^= t;
+        estado[3] = rotl(estado[3], 45);
+        return resultado;
+    }
+
+    // Avança 2^128 passos: cada salto a partir da semente mestre é um fluxo independente
+    void saltar() {
+        static const uint64_t SALTO[4] = {
+            0x180EC6D33CFD0ABAULL, 0xD5A61266F0C9392CULL,
+            0xA9582618E03FC9AAULL, 0x39ABDC4529B1661CULL
+        };
+        uint64_t s[4] = {0, 0, 0, 0};
+        for (int i = 0; i < 4; i++) {
+            for (int b = 0; b < 64; b++) {
+                if (SALTO[i] & (1ULL << b)) {
+                    for (int k = 0; k < 4; k++) {
+                        s[k] ^= estado[k];
+                    }
+                }
+                (*this)();
+            }
+        }
+        for (int k = 0; k < 4; k++) {
+            estado[k] = s[k];
+        }
+    }
+
+    // Inteiro uniforme em [0, n) pelo método de multiplicação de Lemire
+    uint32_t abaixoDe(uint32_t n) {
+        return static_cast<uint32_t>(((*this)() >> 32) * n >> 32);
+    }
+
+    // Fisher-Yates com abaixoDe: mesma ordem em qualquer biblioteca padrão
+    template <class T>
+    void embaralhar(T* valores, int quantidade) {
+        for (int i = quantidade - 1; i > 0; i--) {
+            int j = static_cast<int>(abaixoDe(static_cast<uint32_t>(i + 1)));
+            T temp = valores[i];
+            valores[i] = valores[j];
+            valores[j] = temp;
+        }
+    }
+
+private:
+    uint64_t estado[4];
+
+    static uint64_t rotl(uint64_t x, int k) { return (x << k) | (x >> (64 - k)); }
+};
+
+#endif // XOSHIRO_H
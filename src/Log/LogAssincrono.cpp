@@ -0,0 +1,175 @@
+#include "LogAssincrono.h"
+#include <iostream>
+
+using namespace std;
+
+// Log usado pelas macros - criado no primeiro uso e escrito em std::cout
+LogAssincrono& LogAssincrono::global() {
+    static LogAssincrono log(cout);
+    return log;
+}
+
+// Construtor - cada posição começa livre para a primeira volta
+LogAssincrono::LogAssincrono(ostream& saida)
+    : buffer(new Posicao[CAPACIDADE]), cauda(0), cabeca(0), descartados(0),
+      nivelMinimo(static_cast<int>(NivelLog::INFO)), saida(saida),
+      encerrando(false), pedidoDescarga(0), escritorDormindo(false) {
+    for (size_t i = 0; i < CAPACIDADE; i++) {
+        buffer[i].sequencia.store(i, memory_order_relaxed);
+    }
+    escritor = thread(&LogAssincrono::executarEscritor, this);
+}
+
+// Destrutor - escreve o que ficou no buffer e encerra a thread de fundo
+LogAssincrono::~LogAssincrono() {
+    {
+        lock_guard<mutex> lock(mtx);
+        encerrando = true;
+    }
+    cv.notify_one();
+    escritor.join();
+}
+
+int LogAssincrono::idThread() {
+    static atomic<int> proximo(1);
+    thread_local int id = proximo.fetch_add(1, memory_order_relaxed);
+    return id;
+}
+
+// Reserva uma posição com CAS na cauda e publica o registro pela sequência
+bool LogAssincrono::publicar(NivelLog nivel, const char* formato, const Argumento* args, int numArgs) {
+    size_t pos = cauda.load(memory_order_relaxed);
+    Posicao* p;
+    for (;;) {
+        p = &buffer[pos & (CAPACIDADE - 1)];
+        size_t seq = p->sequencia.load(memory_order_acquire);
+        intptr_t diferenca = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+        if (diferenca == 0) {
+            if (cauda.compare_exchange_weak(pos, pos + 1, memory_order_relaxed)) {
+                break;
+            }
+        } else if (diferenca < 0) {
+            // A consumidora ainda não liberou esta posição: buffer cheio
+            descartados.fetch_add(1, memory_order_relaxed);
+            return false;
+        } else {
+            pos = cauda.load(memory_order_relaxed);
+        }
+    }
+
+    Registro& r = p->registro;
+    r.formato = formato;
+    r.thread = idThread();
+    r.nivel = static_cast<uint8_t>(nivel);
+    r.numArgs = static_cast<uint8_t>(numArgs);
+    for (int i = 0; i < numArgs; i++) {
+        r.args[i] = args[i];
+    }
+    p->sequencia.store(pos + 1, memory_order_release);
+
+    // Só acorda a thread de fundo se ela viu o buffer vazio: no caso comum
+    // (escritora acordada) o registro não faz chamada de sistema. A barreira
+    // pareia com a de executarEscritor: ou ela vê este registro antes de
+    // dormir, ou aqui se vê a marca e o aviso é dado sob a trava.
+    atomic_thread_fence(memory_order_seq_cst);
+    if (escritorDormindo.load(memory_order_relaxed)) {
+        lock_guard<mutex> lock(mtx);
+        cv.notify_one();
+    }
+    return true;
+}
+
+// Troca cada "{}" do formato pelo próximo argumento
+void LogAssincrono::formatar(const Registro& r, string& texto) {
+    if (r.nivel == static_cast<uint8_t>(NivelLog::AVISO)) {
+        texto += "[AVISO] ";
+    } else if (r.nivel == static_cast<uint8_t>(NivelLog::ERRO)) {
+        texto += "[ERRO] ";
+    }
+
+    int proximo = 0;
+    for (const char* c = r.formato; *c; c++) {
+        if (c[0] == '{' && c[1] == '}' && proximo < r.numArgs) {
+            const Argumento& a = r.args[proximo++];
+            if (a.ehTexto) {
+                texto += a.texto ? a.texto : "(nulo)";
+            } else {
+                texto += to_string(a.inteiro);
+            }
+            c++;
+        } else {
+            texto += *c;
+        }
+    }
+    texto += '\n';
+}
+
+bool LogAssincrono::haRegistroPronto() const {
+    size_t pos = cabeca.load(memory_order_relaxed);
+    return buffer[pos & (CAPACIDADE - 1)].sequencia.load(memory_order_acquire) == pos + 1;
+}
+
+// Lê, na ordem de reserva, todos os registros já publicados
+size_t LogAssincrono::consumir(string& texto) {
+    size_t lidos = 0;
+    size_t pos = cabeca.load(memory_order_relaxed);
+    for (;;) {
+        Posicao& p = buffer[pos & (CAPACIDADE - 1)];
+        if (p.sequencia.load(memory_order_acquire) != pos + 1) {
+            break;   // vazio, ou a produtora ainda está gravando esta posição
+        }
+        formatar(p.registro, texto);
+        p.sequencia.store(pos + CAPACIDADE, memory_order_release);
+        pos++;
+        lidos++;
+    }
+    cabeca.store(pos, memory_order_release);
+    return lidos;
+}
+
+// Laço da thread de fundo: esvazia o buffer, escreve tudo de uma vez e dorme
+// até chegar um registro, um pedido de descarga ou o encerramento
+void LogAssincrono::executarEscritor() {
+    string texto;
+    for (;;) {
+        texto.clear();
+        size_t lidos = consumir(texto);
+        if (lidos > 0) {
+            saida.write(texto.data(), static_cast<streamsize>(texto.size()));
+            saida.flush();
+        }
+
+        unique_lock<mutex> lock(mtx);
+        if (cabeca.load(memory_order_relaxed) >= pedidoDescarga) {
+            cvDescarregado.notify_all();
+        }
+        if (lidos > 0) {
+            continue;   // pode haver mais: só dorme com o buffer vazio
+        }
+        if (encerrando) {
+            return;
+        }
+
+        // Marca antes de conferir o buffer pela última vez (ver publicar)
+        escritorDormindo.store(true, memory_order_relaxed);
+        atomic_thread_fence(memory_order_seq_cst);
+        cv.wait(lock, [this]() {
+            return encerrando || pedidoDescarga > cabeca.load(memory_order_relaxed) || haRegistroPronto();
+        });
+        escritorDormindo.store(false, memory_order_relaxed);
+    }
+}
+
+// Aguarda a thread de fundo escrever tudo o que foi reservado até agora
+void LogAssincrono::descarregar() {
+    size_t alvo = cauda.load(memory_order_acquire);
+    if (cabeca.load(memory_order_acquire) >= alvo) {
+        return;   // nada pendente: não acorda a thread de fundo
+    }
+    unique_lock<mutex> lock(mtx);
+    if (alvo > pedidoDescarga) {
+        pedidoDescarga = alvo;
+    }
+    cv.notify_one();
+    cvDescarregado.wait(lock, [this, alvo]() { return cabeca.load(memory_order_acquire) >= alvo; });
+}
@@ -0,0 +1,153 @@
+#ifndef LOGASSINCRONO_H
+#define LOGASSINCRONO_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <thread>
+
+// Níveis de log, do mais detalhado ao mais grave
+enum class NivelLog {
+    DEPURACAO = 0,
+    INFO = 1,
+    AVISO = 2,
+    ERRO = 3,
+    DESLIGADO = 4
+};
+
+// Nível mínimo compilado: chamadas abaixo dele somem do binário
+// (ex.: make CXXFLAGS="-std=c++11 -O2 -pthread -DNIVEL_LOG_COMPILADO=2")
+#ifndef NIVEL_LOG_COMPILADO
+#define NIVEL_LOG_COMPILADO 0
+#endif
+
+// Macros de log. O formato deve ser um literal, com "{}" no lugar de cada
+// argumento; os argumentos podem ser inteiros ou textos com duração estática
+// (literais), pois só o ponteiro é guardado no registro.
+#define LOG_NIVEL(nivel, ...)                                                  \
+    do {                                                                       \
+        if (static_cast<int>(nivel) >= NIVEL_LOG_COMPILADO &&                  \
+            LogAssincrono::global().ativo(nivel)) {                            \
+            LogAssincrono::global().registrar(nivel, __VA_ARGS__);             \
+        }                                                                      \
+    } while (0)
+
+#define LOG_DEPURACAO(...) LOG_NIVEL(NivelLog::DEPURACAO, __VA_ARGS__)
+#define LOG_INFO(...)      LOG_NIVEL(NivelLog::INFO, __VA_ARGS__)
+#define LOG_AVISO(...)     LOG_NIVEL(NivelLog::AVISO, __VA_ARGS__)
+#define LOG_ERRO(...)      LOG_NIVEL(NivelLog::ERRO, __VA_ARGS__)
+
+// Log assíncrono com registros binários de tamanho fixo.
+// Cada thread grava o ponteiro do formato, o nível e até MAX_ARGS argumentos em uma
+// posição de um buffer circular sem trava (fila limitada de Vyukov, várias
+// produtoras e uma consumidora): nenhuma formatação, alocação ou E/S acontece
+// na thread que registra. Uma thread de fundo formata os registros e escreve
+// no fluxo de saída em rajadas. Com o buffer cheio o registro é descartado
+// (e contado), para que o log nunca bloqueie um caminho quente.
+class LogAssincrono {
+public:
+    static const int MAX_ARGS = 6;
+    static const size_t CAPACIDADE = 8192;   // potência de 2
+
+    // Log usado pelas macros, escrevendo em std::cout
+    static LogAssincrono& global();
+
+    explicit LogAssincrono(std::ostream& saida);
+
+    // Destrutor - escreve o que ficou no buffer e encerra a thread de fundo
+    ~LogAssincrono();
+
+    // Método para escolher o nível mínimo em tempo de execução (padrão INFO)
+    void setNivel(NivelLog nivel) { nivelMinimo.store(static_cast<int>(nivel), std::memory_order_relaxed); }
+    NivelLog getNivel() const { return static_cast<NivelLog>(nivelMinimo.load(std::memory_order_relaxed)); }
+
+    bool ativo(NivelLog nivel) const {
+        return static_cast<int>(nivel) >= nivelMinimo.load(std::memory_order_relaxed);
+    }
+
+    // Grava um registro no buffer; retorna false se ele foi descartado
+    template <class... Args>
+    bool registrar(NivelLog nivel, const char* formato, Args... args) {
+        static_assert(sizeof...(Args) <= MAX_ARGS, "argumentos demais para um registro de log");
+        Argumento lista[sizeof...(Args) + 1] = { Argumento(args)..., Argumento() };
+        return publicar(nivel, formato, lista, static_cast<int>(sizeof...(Args)));
+    }
+
+    // Aguarda a thread de fundo escrever tudo o que foi registrado até agora
+    void descarregar();
+
+    // Registros perdidos por buffer cheio
+    long long getDescartados() const { return descartados.load(std::memory_order_relaxed); }
+
+    // Índice pequeno e estável da thread chamadora (1, 2, 3... na ordem do primeiro uso)
+    static int idThread();
+
+private:
+    // Argumento de um registro: inteiro ou ponteiro para texto estático
+    struct Argumento {
+        bool ehTexto;
+        union {
+            long long inteiro;
+            const char* texto;
+        };
+
+        Argumento() : ehTexto(false), inteiro(0) {}
+        Argumento(const char* t) : ehTexto(true), texto(t) {}
+        Argumento(bool v) : ehTexto(false), inteiro(v) {}
+        Argumento(int v) : ehTexto(false), inteiro(v) {}
+        Argumento(unsigned v) : ehTexto(false), inteiro(v) {}
+        Argumento(long v) : ehTexto(false), inteiro(v) {}
+        Argumento(unsigned long v) : ehTexto(false), inteiro(static_cast<long long>(v)) {}
+        Argumento(long long v) : ehTexto(false), inteiro(v) {}
+        Argumento(unsigned long long v) : ehTexto(false), inteiro(static_cast<long long>(v)) {}
+    };
+
+    struct Registro {
+        const char* formato;
+        int32_t thread;
+        uint8_t nivel;
+        uint8_t numArgs;
+        Argumento args[MAX_ARGS];
+    };
+
+    // Posição do buffer: 'sequencia' diz se ela está livre para a produtora
+    // da volta atual ou pronta para a consumidora
+    struct Posicao {
+        std::atomic<size_t> sequencia;
+        Registro registro;
+    };
+
+    std::unique_ptr<Posicao[]> buffer;
+    alignas(64) std::atomic<size_t> cauda;      // próxima posição a reservar (produtoras)
+    alignas(64) std::atomic<size_t> cabeca;     // próxima posição a ler (consumidora)
+    std::atomic<long long> descartados;
+    std::atomic<int> nivelMinimo;
+
+    std::ostream& saida;
+    std::mutex mtx;
+    std::condition_variable cv;                 // acorda a thread de fundo
+    std::condition_variable cvDescarregado;     // avisa quem espera em descarregar()
+    bool encerrando;
+    size_t pedidoDescarga;                      // maior posição que alguém espera ver escrita
+    std::atomic<bool> escritorDormindo;         // a thread de fundo viu o buffer vazio e vai esperar em 'cv'
+    std::thread escritor;
+
+    bool publicar(NivelLog nivel, const char* formato, const Argumento* args, int numArgs);
+
+    // Há registro publicado na posição da cabeça (só a consumidora chama)
+    bool haRegistroPronto() const;
+
+    // Lê e formata todos os registros disponíveis; retorna quantos leu
+    size_t consumir(std::string& texto);
+
+    static void formatar(const Registro& r, std::string& texto);
+
+    // Laço da thread de fundo
+    void executarEscritor();
+};
+
+#endif // LOGASSINCRONO_H
@@ -0,0 +1,179 @@
+#include "ContadoresHardware.h"
+#include <cerrno>
+#include <cstring>
+#include <mutex>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+using namespace std;
+
+namespace {
+
+mutex mtxMotivo;
+string motivo;          // preenchido pela primeira abertura que falhar
+bool motivoDefinido = false;
+
+void registrarMotivo(const string& texto) {
+    lock_guard<mutex> lock(mtxMotivo);
+    if (!motivoDefinido) {
+        motivo = texto;
+        motivoDefinido = true;
+    }
+}
+
+#ifdef __linux__
+int abrirEvento(EventoHW evento, int lider) {
+    perf_event_attr attr;
+    memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.disabled = lider < 0 ? 1 : 0;   // o grupo é ligado pelo líder
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    attr.read_format = PERF_FORMAT_GROUP;
+
+    switch (evento) {
+        case EventoHW::CICLOS:
+            attr.type = PERF_TYPE_HARDWARE;
+            attr.config = PERF_COUNT_HW_CPU_CYCLES;
+            break;
+        case EventoHW::INSTRUCOES:
+            attr.type = PERF_TYPE_HARDWARE;
+            attr.config = PERF_COUNT_HW_INSTRUCTIONS;
+            break;
+        case EventoHW::FALTAS_CACHE:
+            attr.type = PERF_TYPE_HARDWARE;
+            attr.config = PERF_COUNT_HW_CACHE_MISSES;
+            break;
+        case EventoHW::ERROS_DESVIO:
+            attr.type = PERF_TYPE_HARDWARE;
+            attr.config = PERF_COUNT_HW_BRANCH_MISSES;
+            break;
+        default:
+            attr.type = PERF_TYPE_SOFTWARE;
+            attr.config = PERF_COUNT_SW_CONTEXT_SWITCHES;
+            break;
+    }
+
+    // pid 0, cpu -1: só a thread chamadora, em qualquer CPU
+    return static_cast<int>(syscall(__NR_perf_event_open, &attr, 0, -1, lider, 0));
+}
+#endif
+
+} // namespace
+
+void ContadoresHW::zerar() {
+    for (int i = 0; i < NUM_EVENTOS_HW; i++) {
+        valores[i] = -1;
+    }
+    numMedicoes = 0;
+}
+
+void ContadoresHW::somar(const ContadoresHW& outro) {
+    for (int i = 0; i < NUM_EVENTOS_HW; i++) {
+        if (outro.valores[i] >= 0) {
+            valores[i] = (valores[i] >= 0 ? valores[i] : 0) + outro.valores[i];
+        }
+    }
+    numMedicoes += outro.numMedicoes;
+}
+
+double ContadoresHW::ipc() const {
+    long long ciclos = get(EventoHW::CICLOS);
+    long long instrucoes = get(EventoHW::INSTRUCOES);
+    return ciclos > 0 && instrucoes >= 0 ? static_cast<double>(instrucoes) / ciclos : 0.0;
+}
+
+const char* nomeEventoHW(EventoHW evento) {
+    switch (evento) {
+        case EventoHW::CICLOS:          return "ciclos";
+        case EventoHW::INSTRUCOES:      return "instruções";
+        case EventoHW::FALTAS_CACHE:    return "faltas de cache";
+        case EventoHW::ERROS_DESVIO:    return "erros de previsão de desvio";
+        case EventoHW::TROCAS_CONTEXTO: return "trocas de contexto";
+        default:                        return "?";
+    }
+}
+
+// Construtor - abre os eventos que existirem; o primeiro aberto é o líder
+GrupoContadores::GrupoContadores() : numNoGrupo(0), lider(-1) {
+    for (int i = 0; i < NUM_EVENTOS_HW; i++) {
+        descritores[i] = -1;
+        posicaoNoGrupo[i] = -1;
+    }
+
+#ifdef __linux__
+    int primeiroErro = 0;
+    for (int i = 0; i < NUM_EVENTOS_HW; i++) {
+        int fd = abrirEvento(static_cast<EventoHW>(i), lider);
+        if (fd < 0) {
+            if (primeiroErro == 0) primeiroErro = errno;
+            continue;
+        }
+        descritores[i] = fd;
+        posicaoNoGrupo[i] = numNoGrupo++;
+        if (lider < 0) lider = fd;
+    }
+
+    if (lider < 0) {
+        registrarMotivo(string("perf_event_open: ") + strerror(primeiroErro));
+    } else if (primeiroErro != 0) {
+        registrarMotivo(string("alguns eventos indisponíveis: ") + strerror(primeiroErro));
+    }
+#else
+    registrarMotivo("perf_event_open só existe no Linux");
+#endif
+}
+
+GrupoContadores::~GrupoContadores() {
+#ifdef __linux__
+    for (int i = 0; i < NUM_EVENTOS_HW; i++) {
+        if (descritores[i] >= 0) close(descritores[i]);
+    }
+#endif
+}
+
+void GrupoContadores::iniciar() {
+#ifdef __linux__
+    if (lider < 0) return;
+    ioctl(lider, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+    ioctl(lider, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+#endif
+}
+
+ContadoresHW GrupoContadores::parar() {
+    ContadoresHW c;
+#ifdef __linux__
+    if (lider < 0) return c;
+    ioctl(lider, PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+
+    // Leitura em grupo: { nr, valor[nr] } na ordem de abertura
+    unsigned long long buffer[1 + NUM_EVENTOS_HW];
+    ssize_t lidos = read(lider, buffer, sizeof(buffer));
+    if (lidos < static_cast<ssize_t>(sizeof(unsigned long long)) ||
+        buffer[0] != static_cast<unsigned long long>(numNoGrupo)) {
+        return c;
+    }
+    for (int i = 0; i < NUM_EVENTOS_HW; i++) {
+        if (posicaoNoGrupo[i] >= 0) {
+            c.valores[i] = static_cast<long long>(buffer[1 + posicaoNoGrupo[i]]);
+        }
+    }
+    c.numMedicoes = 1;
+#endif
+    return c;
+}
+
+GrupoContadores& GrupoContadores::daThread() {
+    thread_local GrupoContadores grupo;
+    return grupo;
+}
+
+string GrupoContadores::motivoIndisponivel() {
+    lock_guard<mutex> lock(mtxMotivo);
+    return motivo;
+}
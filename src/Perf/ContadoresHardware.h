@@ -0,0 +1,86 @@
+#ifndef CONTADORESHARDWARE_H
+#define CONTADORESHARDWARE_H
+
+#include <string>
+
+// Eventos medidos, na ordem em que são abertos
+enum class EventoHW {
+    CICLOS,
+    INSTRUCOES,
+    FALTAS_CACHE,
+    ERROS_DESVIO,
+    TROCAS_CONTEXTO,
+    NUM_EVENTOS
+};
+
+const int NUM_EVENTOS_HW = static_cast<int>(EventoHW::NUM_EVENTOS);
+
+// Valores dos contadores de hardware de um trecho medido.
+// Um evento que o kernel ou a CPU não oferece fica com -1.
+struct ContadoresHW {
+    long long valores[NUM_EVENTOS_HW];
+    int numMedicoes;    // trechos somados neste total
+
+    ContadoresHW() { zerar(); }
+
+    void zerar();
+
+    // Acumula outro total; eventos indisponíveis continuam -1
+    void somar(const ContadoresHW& outro);
+
+    long long get(EventoHW evento) const { return valores[static_cast<int>(evento)]; }
+    bool temEvento(EventoHW evento) const { return get(evento) >= 0; }
+
+    // Instruções por ciclo (0 se algum dos dois estiver indisponível)
+    double ipc() const;
+};
+
+// Contadores somados de uma thread (índice da thread no pool, ou 0 para a
+// thread de validação única)
+struct ContadoresThread {
+    int thread;
+    int tarefas;
+    ContadoresHW contadores;
+
+    ContadoresThread() : thread(0), tarefas(0) {}
+};
+
+// Nome legível do evento ("ciclos", "instruções"...)
+const char* nomeEventoHW(EventoHW evento);
+
+// Contadores perf_event_open da thread que os criou.
+// Os eventos são abertos uma única vez, em grupo, contando só o espaço de
+// usuário (funciona com perf_event_paranoid <= 2); iniciar() e parar() custam
+// três chamadas de sistema no total. Quando perf_event_open não existe ou é
+// negado (contêineres, outros sistemas), disponivel() é false e parar()
+// devolve todos os eventos como -1, sem erro.
+class GrupoContadores {
+public:
+    GrupoContadores();
+    ~GrupoContadores();
+
+    bool disponivel() const { return lider >= 0; }
+
+    // Zera e liga os contadores do grupo
+    void iniciar();
+
+    // Desliga os contadores e devolve o que foi contado desde iniciar()
+    ContadoresHW parar();
+
+    // Grupo da thread chamadora, aberto no primeiro uso
+    static GrupoContadores& daThread();
+
+    // Motivo da primeira falha de abertura no processo ("" se todos os eventos abriram)
+    static std::string motivoIndisponivel();
+
+private:
+    int descritores[NUM_EVENTOS_HW];
+    int posicaoNoGrupo[NUM_EVENTOS_HW];   // índice do evento na leitura em grupo (-1 = fora)
+    int numNoGrupo;
+    int lider;
+
+    GrupoContadores(const GrupoContadores&) = delete;
+    GrupoContadores& operator=(const GrupoContadores&) = delete;
+};
+
+#endif // CONTADORESHARDWARE_H
@@ -0,0 +1,378 @@
+#include "ContadorSolucoes.h"
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <thread>
+#include "../ThreadPool/AlocadorAlinhado.h"
+#include "../ThreadPool/DequeRoubo.h"
+#include "../Trace/Rastreador.h"
+#include "EstadoMascaras.h"
+
+using namespace std;
+
+namespace {
+
+// Contagem sequencial: as vazias são preenchidas recursivamente, desfazendo
+// as máscaras ao voltar
+struct Contador : EstadoMascaras {
+    int encontradas;
+    int limite;
+
+    // Preenche as vazias a partir da posição n; retorna true quando atingiu o limite
+    bool buscar(int n) {
+        if (n == numVazias) {
+            return ++encontradas >= limite;
+        }
+
+        uint16_t candMelhor;
+        int melhor = escolher(n, candMelhor);
+        if (melhor < 0) {
+            return false;
+        }
+
+        uint8_t celula = vazias[melhor];
+        vazias[melhor] = vazias[n];
+        vazias[n] = celula;
+
+        bool parar = false;
+        for (uint16_t c = candMelhor; c && !parar; c &= c - 1) {
+            uint16_t bit = c & -c;
+            alternar(celula, bit);
+            parar = buscar(n + 1);
+            alternar(celula, bit);
+        }
+
+        // Desfaz a troca para que a lista volte como estava neste nível
+        vazias[n] = vazias[melhor];
+        vazias[melhor] = celula;
+        return parar;
+    }
+};
+
+
+// ---------------------------------------------------------------------------
+// Contagem paralela
+
+// Subárvores por trabalhador buscadas na divisão inicial (o resto do
+// equilíbrio fica com as doações durante a busca)
+const size_t SUBARVORES_POR_TRABALHADOR = 8;
+
+// A cada quantos nós um trabalhador confere a parada e os ociosos
+const long long INTERVALO_VERIFICACAO = 1024;
+
+// Estado compartilhado por uma contagem paralela. Os atômicos escritos com
+// frequência ficam cada um na sua linha de cache.
+struct ContextoContagem {
+    long long limite;
+    long long lotePublicacao;   // soluções acumuladas antes de publicar no total
+    const function<void(const Tabuleiro&)>* aoEncontrar;
+    vector<DequeRoubo<Tabuleiro>> deques;
+
+    alignas(64) atomic<long long> publicadas;   // soluções já somadas ao total visível
+    alignas(64) atomic<long long> pendentes;    // subárvores criadas e ainda não terminadas
+    alignas(64) atomic<int> ociosos;
+    alignas(64) atomic<bool> parar;
+
+    explicit ContextoContagem(unsigned numTrabalhadores)
+        : limite(0), lotePublicacao(1), aoEncontrar(nullptr), deques(numTrabalhadores),
+          publicadas(0), pendentes(0), ociosos(0), parar(false) {}
+};
+
+// Contadores de um trabalhador, cada um na sua linha de cache
+struct alignas(64) ContagemTrabalhador {
+    long long solucoes;
+    long long nos;
+    long long roubadas;
+    long long doadas;
+};
+
+// Busca de um trabalhador: a mesma árvore do Contador, mas os dígitos ainda
+// não tentados em cada nível ficam em 'restantes', de onde podem ser cedidos
+// como subárvores para trabalhadores ociosos.
+struct BuscaTrabalhador {
+    EstadoMascaras c;
+    ContextoContagem& ctx;
+    DequeRoubo<Tabuleiro>& deque;
+    ContagemTrabalhador& contagem;
+    uint16_t restantes[81];
+    long long naoPublicadas;
+
+    BuscaTrabalhador(ContextoContagem& ctx, DequeRoubo<Tabuleiro>& deque, ContagemTrabalhador& contagem)
+        : ctx(ctx), deque(deque), contagem(contagem), naoPublicadas(0) {}
+
+    // Soma as soluções locais ao total visível; true se o limite foi atingido
+    bool publicar() {
+        long long total = ctx.publicadas.fetch_add(naoPublicadas) + naoPublicadas;
+        naoPublicadas = 0;
+        if (total >= ctx.limite) {
+            ctx.parar.store(true, memory_order_relaxed);
+            return true;
+        }
+        return false;
+    }
+
+    // Registra a solução completa em c.valor; true se a busca deve parar
+    bool registrarSolucao() {
+        contagem.solucoes++;
+        if (ctx.aoEncontrar) {
+            // Uma senha por solução: só as 'limite' primeiras são entregues
+            long long senha = ctx.publicadas.fetch_add(1);
+            if (senha < ctx.limite) {
+                Tabuleiro solucao;
+                memcpy(solucao.celulas, c.valor, 81);
+                (*ctx.aoEncontrar)(solucao);
+            }
+            if (senha + 1 >= ctx.limite) {
+                ctx.parar.store(true, memory_order_relaxed);
+                return true;
+            }
+            return false;
+        }
+        return ++naoPublicadas >= ctx.lotePublicacao && publicar();
+    }
+
+    // Cede como subárvores os dígitos não tentados do nível mais raso abaixo
+    // de n (os ramos maiores). O tabuleiro de cada uma são as atribuições dos
+    // níveis acima mais o dígito cedido.
+    void doar(int n) {
+        for (int nivel = 0; nivel < n; nivel++) {
+            if (!restantes[nivel]) continue;
+
+            Tabuleiro base;
+            memcpy(base.celulas, c.valor, 81);
+            for (int k = nivel; k < n; k++) {
+                base.celulas[c.vazias[k]] = 0;
+            }
+            for (uint16_t r = restantes[nivel]; r; r &= r - 1) {
+                Tabuleiro sub = base;
+                sub.celulas[c.vazias[nivel]] = static_cast<uint8_t>(__builtin_ctz(r) + 1);
+                ctx.pendentes.fetch_add(1);
+                deque.empilhar(sub);
+                contagem.doadas++;
+            }
+            restantes[nivel] = 0;
+            return;
+        }
+    }
+
+    bool buscar(int n) {
+        if (n == c.numVazias) {
+            return registrarSolucao();
+        }
+
+        if (++contagem.nos % INTERVALO_VERIFICACAO == 0) {
+            if (ctx.parar.load(memory_order_relaxed)) {
+                return true;
+            }
+            if (ctx.ociosos.load(memory_order_relaxed) > 0 && deque.vazio()) {
+                doar(n);
+            }
+        }
+
+        uint16_t candMelhor;
+        int melhor = c.escolher(n, candMelhor);
+        if (melhor < 0) {
+            return false;
+        }
+
+        uint8_t celula = c.vazias[melhor];
+        c.vazias[melhor] = c.vazias[n];
+        c.vazias[n] = celula;
+
+        // 'restantes' é relido a cada volta: uma doação pode tê-lo esvaziado
+        restantes[n] = candMelhor;
+        bool parar = false;
+        while (restantes[n] && !parar) {
+            uint16_t bit = restantes[n] & -restantes[n];
+            restantes[n] ^= bit;
+            c.alternar(celula, bit);
+            parar = buscar(n + 1);
+            c.alternar(celula, bit);
+        }
+
+        c.vazias[n] = c.vazias[melhor];
+        c.vazias[melhor] = celula;
+        return parar;
+    }
+
+    // Conta as soluções de uma subárvore (consistente por construção)
+    void processar(const Tabuleiro& subarvore) {
+        c.iniciar(subarvore);
+        buscar(0);
+        if (naoPublicadas > 0) {
+            publicar();
+        }
+    }
+};
+
+// Laço de um trabalhador: o próprio deque, depois roubo em ordem circular,
+// até não restar subárvore pendente ou a parada ser pedida
+void executarTrabalhador(ContextoContagem& ctx, unsigned w, ContagemTrabalhador& contagem) {
+    unsigned numTrabalhadores = static_cast<unsigned>(ctx.deques.size());
+    BuscaTrabalhador busca(ctx, ctx.deques[w], contagem);
+    bool ocioso = false;
+
+    while (!ctx.parar.load(memory_order_relaxed)) {
+        Tabuleiro subarvore;
+        bool obtida = ctx.deques[w].retirar(subarvore);
+        for (unsigned k = 1; !obtida && k < numTrabalhadores; k++) {
+            obtida = ctx.deques[(w + k) % numTrabalhadores].roubar(subarvore);
+            if (obtida) {
+                contagem.roubadas++;
+            }
+        }
+
+        if (!obtida) {
+            // Nada nos deques, mas alguém ainda busca e pode ceder um ramo
+            if (ctx.pendentes.load() == 0) {
+                break;
+            }
+            if (!ocioso) {
+                ocioso = true;
+                ctx.ociosos.fetch_add(1);
+            }
+            this_thread::yield();
+            continue;
+        }
+
+        if (ocioso) {
+            ocioso = false;
+            ctx.ociosos.fetch_sub(1);
+        }
+        busca.processar(subarvore);
+        ctx.pendentes.fetch_sub(1);
+    }
+
+    if (ocioso) {
+        ctx.ociosos.fetch_sub(1);
+    }
+}
+
+} // namespace
+
+int contarSolucoes(const Tabuleiro& tabuleiro, int limite) {
+    Contador c;
+    c.encontradas = 0;
+    c.limite = limite;
+    if (!c.iniciar(tabuleiro)) {
+        return 0; // dígito repetido em alguma unidade
+    }
+
+    if (limite > 0) {
+        c.buscar(0);
+    }
+    return c.encontradas;
+}
+
+// Construtor
+ContadorParalelo::ContadorParalelo(shared_ptr<ThreadPool> pool) : pool(pool) {
+    stats.numTrabalhadores = 0;
+    stats.subarvoresIniciais = 0;
+    stats.subarvoresDoadas = 0;
+    stats.subarvoresRoubadas = 0;
+    stats.nosVisitados = 0;
+    stats.tempoEmNs = chrono::nanoseconds(0);
+}
+
+long long ContadorParalelo::contar(const Tabuleiro& tabuleiro, long long limite) {
+    return executar(tabuleiro, limite, nullptr);
+}
+
+long long ContadorParalelo::enumerar(const Tabuleiro& tabuleiro, long long limite,
+                                     const function<void(const Tabuleiro&)>& aoEncontrar) {
+    return executar(tabuleiro, limite, &aoEncontrar);
+}
+
+long long ContadorParalelo::executar(const Tabuleiro& tabuleiro, long long limite,
+                                     const function<void(const Tabuleiro&)>* aoEncontrar) {
+    RASTREAR("ContadorParalelo::executar", "solver");
+    auto inicio = chrono::high_resolution_clock::now();
+
+    unsigned numTrabalhadores = max(pool->numThreads(), 1u);
+    stats.numTrabalhadores = static_cast<int>(numTrabalhadores);
+    stats.subarvoresIniciais = 0;
+    stats.subarvoresDoadas = 0;
+    stats.subarvoresRoubadas = 0;
+    stats.nosVisitados = 0;
+    stats.solucoesPorTrabalhador.assign(numTrabalhadores, 0);
+
+    ContextoContagem ctx(numTrabalhadores);
+    ctx.limite = limite;
+    ctx.aoEncontrar = aoEncontrar;
+    ctx.lotePublicacao = min(max(limite / (8 * static_cast<long long>(numTrabalhadores)), 1LL), 64LL);
+
+    // Divisão inicial em largura, com a mesma escolha de célula da busca,
+    // até haver subárvores para todos. Soluções achadas aqui contam à parte.
+    long long solucoesRaiz = 0;
+    vector<Tabuleiro> fronteira;
+    EstadoMascaras c;
+    if (limite > 0 && c.iniciar(tabuleiro)) {
+        fronteira.push_back(tabuleiro);
+    }
+    while (!fronteira.empty() && fronteira.size() < SUBARVORES_POR_TRABALHADOR * numTrabalhadores) {
+        vector<Tabuleiro> proxima;
+        for (const Tabuleiro& t : fronteira) {
+            c.iniciar(t);
+            if (c.numVazias == 0) {
+                if (ctx.publicadas.fetch_add(1) < limite) {
+                    solucoesRaiz++;
+                    if (aoEncontrar) {
+                        (*aoEncontrar)(t);
+                    }
+                }
+                continue;
+            }
+            uint16_t cand;
+            int melhor = c.escolher(0, cand);
+            if (melhor < 0) continue;
+            for (; cand; cand &= cand - 1) {
+                Tabuleiro filho = t;
+                filho.celulas[c.vazias[melhor]] = static_cast<uint8_t>(__builtin_ctz(cand) + 1);
+                proxima.push_back(filho);
+            }
+        }
+        fronteira.swap(proxima);
+    }
+    if (solucoesRaiz >= limite) {
+        fronteira.clear();
+    }
+
+    // Faixas contíguas da fronteira, empilhadas do fim para o começo
+    size_t numSubarvores = fronteira.size();
+    for (unsigned w = 0; w < numTrabalhadores; w++) {
+        size_t primeira = numSubarvores * w / numTrabalhadores;
+        size_t ultima = numSubarvores * (w + 1) / numTrabalhadores;
+        for (size_t k = ultima; k > primeira; k--) {
+            ctx.deques[w].empilhar(fronteira[k - 1]);
+        }
+    }
+    ctx.pendentes.store(static_cast<long long>(numSubarvores));
+    stats.subarvoresIniciais = static_cast<long long>(numSubarvores);
+
+    VetorAlinhado<ContagemTrabalhador> contagens(numTrabalhadores);   // alocador respeita o alignas(64)
+    if (numSubarvores > 0) {
+        ThreadPool::Lote lote(*pool);
+        for (unsigned w = 0; w < numTrabalhadores; w++) {
+            lote.enviar([&ctx, &contagens, w]() {
+                executarTrabalhador(ctx, w, contagens[w]);
+            });
+        }
+        lote.aguardar();
+    }
+
+    // Soma das contagens de cada trabalhador; passar do limite só acontece
+    // entre o limite ser atingido e os outros perceberem a parada
+    long long total = solucoesRaiz;
+    for (unsigned w = 0; w < numTrabalhadores; w++) {
+        const ContagemTrabalhador& ct = contagens[w];
+        total += ct.solucoes;
+        stats.solucoesPorTrabalhador[w] = ct.solucoes;
+        stats.nosVisitados += ct.nos;
+        stats.subarvoresRoubadas += ct.roubadas;
+        stats.subarvoresDoadas += ct.doadas;
+    }
+
+    stats.tempoEmNs = chrono::duration_cast<chrono::nanoseconds>(
+        chrono::high_resolution_clock::now() - inicio);
+    return limite > 0 ? min(total, limite) : 0;
+}
@@ -0,0 +1,69 @@
+#ifndef CONTADORSOLUCOES_H
+#define CONTADORSOLUCOES_H
+
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <vector>
+#include "../Tabuleiro/Tabuleiro.h"
+#include "../ThreadPool/ThreadPool.h"
+
+// Contador de soluções com parada antecipada.
+// Busca própria em máscaras de bits: a lista de células vazias é reordenada no
+// lugar (MRV, com hidden singles quando nenhuma célula tem candidato único) e as
+// máscaras de linha/coluna/bloco são desfeitas ao voltar, sem cópias de estado.
+// Com limite 2 responde "a solução é única?" em microssegundos, rápido o
+// bastante para ~81 chamadas por quebra-cabeça gerado.
+//
+// Retorna o número de soluções encontradas, no máximo 'limite'
+// (0 se o tabuleiro já tiver conflitos).
+int contarSolucoes(const Tabuleiro& tabuleiro, int limite = 2);
+
+// Estatísticas da última contagem paralela
+struct EstatisticasContagem {
+    int numTrabalhadores;
+    long long subarvoresIniciais;     // ramos criados pela divisão dos primeiros níveis
+    long long subarvoresDoadas;       // ramos cedidos a trabalhadores ociosos durante a busca
+    long long subarvoresRoubadas;     // ramos executados por um trabalhador que não era o dono
+    long long nosVisitados;
+    std::vector<long long> solucoesPorTrabalhador;
+    std::chrono::nanoseconds tempoEmNs;
+};
+
+// Contagem paralela para tabuleiros com muitas soluções (ex.: os que sobram
+// com poucas pistas), com a mesma árvore de busca de contarSolucoes().
+// Os primeiros níveis da árvore são divididos em subárvores, distribuídas em
+// faixas pelos deques dos trabalhadores (DequeRoubo); quem esvazia o próprio
+// deque rouba dos outros. Enquanto houver trabalhador ocioso, quem está
+// ocupado cede os dígitos ainda não tentados do seu nível mais raso, que viram
+// subárvores no seu deque para serem roubadas. Cada trabalhador conta as suas
+// soluções e as contagens são somadas no fim; o total publicado só serve para
+// parar todos ao atingir o limite.
+//
+// O resultado é sempre igual ao de contarSolucoes() com o mesmo limite:
+// min(soluções, limite), 0 se houver conflito. Não chamar de dentro de uma
+// tarefa do mesmo pool (a chamada espera os trabalhadores).
+class ContadorParalelo {
+public:
+    explicit ContadorParalelo(std::shared_ptr<ThreadPool> pool = ThreadPool::compartilhado());
+
+    // Conta as soluções, parando ao atingir 'limite'
+    long long contar(const Tabuleiro& tabuleiro, long long limite);
+
+    // Como contar(), entregando cada solução a 'aoEncontrar' (no máximo
+    // 'limite' delas). A função é chamada pelas threads do pool, ao mesmo
+    // tempo e em ordem qualquer: a sincronização fica com quem a passa.
+    long long enumerar(const Tabuleiro& tabuleiro, long long limite,
+                       const std::function<void(const Tabuleiro&)>& aoEncontrar);
+
+    const EstatisticasContagem& getEstatisticas() const { return stats; }
+
+private:
+    std::shared_ptr<ThreadPool> pool;
+    EstatisticasContagem stats;
+
+    long long executar(const Tabuleiro& tabuleiro, long long limite,
+                       const std::function<void(const Tabuleiro&)>* aoEncontrar);
+};
+
+#endif // CONTADORSOLUCOES_H
@@ -0,0 +1,113 @@
+#include "CorpusTeste.h"
+#include "SolverBacktracking.h"
+#include "SolverPropagacao.h"
+#include "SolverDLX.h"
+#include "SolverPortfolio.h"
+#include <cstring>
+
+using namespace std;
+
+// Quebra-cabeças com solução única, do trivial ao patológico para backtracking
+const CasoTeste CORPUS_TESTE[] = {
+    // Exemplo da Wikipédia
+    { "53..7....6..195....98....6.8...6...34..8.3..17...2...6.6....28....419..5....8..79",
+      "534678912672195348198342567859761423426853791713924856961537284287419635345286179" },
+    // Arto Inkala (2012)
+    { "8..........36......7..9.2...5...7.......457.....1...3...1....68..85...1..9....4..",
+      "812753649943682175675491283154237896369845721287169534521974368438526917796318452" },
+    // AI Escargot
+    { "1....7.9..3..2...8..96..5....53..9...1..8...26....4...3......1..4......7..7...3..",
+      "162857493534129678789643521475312986913586742628794135356478219241935867897261354" },
+    // Pior caso para backtracking em ordem de linhas
+    { "..............3.85..1.2.......5.7.....4...1...9.......5......73..2.1........4...9",
+      "987654321246173985351928746128537694634892157795461832519286473472319568863745219" },
+    // Difícil
+    { "4.....8.5.3..........7......2.....6.....8.4......1.......6.3.7.5..2.....1.4......",
+      "417369825632158947958724316825437169791586432346912758289643571573291684164875293" },
+    // Fácil
+    { "..3.2.6..9..3.5..1..18.64....81.29..7.......8..67.82....26.95..8..2.3..9..5.1.3..",
+      "483921657967345821251876493548132976729564138136798245372689514814253769695417382" },
+    // 17 pistas
+    { "...8.1..........435............7.8........1...2..3....6......75..34........2..6..",
+      "237841569186795243594326718315674892469582137728139456642918375853467921971253684" },
+    // Difícil
+    { ".2.4.37.........32........4.4.2...7.8...5.........1...5.....9...3.9....7..1..86..",
+      "925413786684579132317682594143296875869357241752841369576134928238965417491728653" },
+    // Difícil
+    { "..53.....8......2..7..1.5..4....53...1..7...6..32...8..6.5....9..4....3......97..",
+      "145327698839654127672918543496185372218473956753296481367542819984761235521839764" },
+    // Difícil
+    { "12.3....435....1....4........54..2..6...7.........8.9...31..5.......9.7.....6...8",
+      "126395784359847162874621953985416237631972845247538691763184529418259376592763418" }
+};
+
+const int TAMANHO_CORPUS_TESTE = sizeof(CORPUS_TESTE) / sizeof(CORPUS_TESTE[0]);
+
+namespace {
+
+// Nós do backtracking por caso: os casos feitos contra a ordem de linhas
+// passam de dezenas de milhões de nós (segundos cada) e são pulados
+const long long LIMITE_NOS_BACKTRACKING = 2000000;
+
+} // namespace
+
+// Resolve o corpus com todos os motores e confere com as soluções conhecidas
+bool verificarMotoresSolver(ostream& saida) {
+    SolverBacktracking backtracking(1);   // semente fixa: a saída se repete entre execuções
+    backtracking.setLimiteNos(LIMITE_NOS_BACKTRACKING);
+    SolverDLX dlx;
+    SolverPortfolio portfolio(1);
+    portfolio.setLimiteTentativaInicial(0);   // sempre corre, para exercitar as estratégias
+    bool tudoCerto = true;
+
+    for (int k = 0; k < TAMANHO_CORPUS_TESTE; k++) {
+        Tabuleiro puzzle, esperado;
+        puzzle.carregarTexto(CORPUS_TESTE[k].puzzle);
+        esperado.carregarTexto(CORPUS_TESTE[k].solucao);
+
+        // Solução única: a ordem aleatória dos dígitos não muda o resultado
+        Tabuleiro porBacktracking = puzzle;
+        bool okBacktracking = backtracking.resolver(porBacktracking) &&
+                              memcmp(porBacktracking.celulas, esperado.celulas, 81) == 0;
+        bool puladoBacktracking = backtracking.foiInterrompido();
+
+        Tabuleiro porPropagacao = puzzle;
+        SolverPropagacao propagacao;
+        bool okPropagacao = propagacao.resolver(porPropagacao) &&
+                            memcmp(porPropagacao.celulas, esperado.celulas, 81) == 0;
+
+        Tabuleiro porDlx = puzzle;
+        bool okDlx = dlx.resolver(porDlx) &&
+                     memcmp(porDlx.celulas, esperado.celulas, 81) == 0;
+        long long nsDlx = dlx.getEstatisticas().tempoEmNs.count();
+
+        Tabuleiro porPortfolio = puzzle;
+        bool okPortfolio = portfolio.resolver(porPortfolio) &&
+                           memcmp(porPortfolio.celulas, esperado.celulas, 81) == 0;
+
+        int solucoes = dlx.contarSolucoes(puzzle, 2);
+
+        saida << "[" << (k + 1) << "] backtracking: ";
+        if (puladoBacktracking) {
+            saida << "pulado (mais de " << LIMITE_NOS_BACKTRACKING << " nós) | ";
+        } else {
+            saida << (okBacktracking ? "OK" : "FALHOU")
+                  << " (" << backtracking.getEstatisticas().tempoEmNs.count() << "ns, "
+                  << backtracking.getEstatisticas().nosVisitados << " nós) | ";
+        }
+        saida << "propagação: " << (okPropagacao ? "OK" : "FALHOU")
+              << " (" << propagacao.getEstatisticas().tempoEmNs.count() << "ns, "
+              << propagacao.getEstatisticas().nosVisitados << " nós) | "
+              << "DLX: " << (okDlx ? "OK" : "FALHOU")
+              << " (" << nsDlx << "ns) | "
+              << "portfólio: " << (okPortfolio ? "OK" : "FALHOU")
+              << " (" << nomeEstrategiaSolver(portfolio.getResultado().vencedora) << ") | "
+              << "soluções: " << solucoes << endl;
+
+        if ((!okBacktracking && !puladoBacktracking) || !okPropagacao || !okDlx || !okPortfolio || solucoes != 1) {
+            tudoCerto = false;
+        }
+    }
+
+    return tudoCerto;
+}
@@ -0,0 +1,22 @@
+#ifndef CORPUSTESTE_H
+#define CORPUSTESTE_H
+
+#include <ostream>
+#include "../Tabuleiro/Tabuleiro.h"
+
+// Quebra-cabeça (81 caracteres, '.' = vazio) e sua solução única
+struct CasoTeste {
+    const char* puzzle;
+    const char* solucao;
+};
+
+// Corpus compartilhado usado para conferir que todos os motores de solver
+// produzem o mesmo resultado
+extern const CasoTeste CORPUS_TESTE[];
+extern const int TAMANHO_CORPUS_TESTE;
+
+// Resolve o corpus com todos os motores, imprime um relatório e retorna
+// true se todos encontraram a solução esperada
+bool verificarMotoresSolver(std::ostream& saida);
+
+#endif // CORPUSTESTE_H
@@ -0,0 +1,182 @@
+#include "EnumeradorSolucoes.h"
+#include <cstring>
+#include <sstream>
+
+using namespace std;
+
+namespace {
+
+const char LETRAS_SITUACAO[3] = { 'i', 's', 't' };
+
+} // namespace
+
+// ---------------------------------------------------------------------------
+// Ponto de retomada
+
+string PontoRetomada::paraTexto() const {
+    char texto[82];
+    tabuleiro.paraTexto(texto);
+
+    ostringstream saida;
+    saida << texto << ' ' << entregues << ' ' << LETRAS_SITUACAO[static_cast<int>(situacao)];
+    for (int k = 0; k < profundidade; k++) {
+        saida << static_cast<char>('0' + digitos[k]);
+    }
+    return saida.str();
+}
+
+bool PontoRetomada::carregarTexto(const string& texto) {
+    istringstream entrada(texto);
+    string celulas, caminho, sobra;
+    if (!(entrada >> celulas >> entregues >> caminho) || entregues < 0 || entrada >> sobra) {
+        return false;
+    }
+    // Tabuleiro::carregarTexto lê só as 81 primeiras: um token mais longo está corrompido
+    if (celulas.size() != static_cast<size_t>(NUM_CELULAS) || !tabuleiro.carregarTexto(celulas.c_str())) {
+        return false;
+    }
+
+    int indiceSituacao = 0;
+    while (indiceSituacao < 3 && LETRAS_SITUACAO[indiceSituacao] != caminho[0]) {
+        indiceSituacao++;
+    }
+    if (indiceSituacao == 3 || caminho.size() - 1 > static_cast<size_t>(NUM_CELULAS)) {
+        return false;
+    }
+    situacao = static_cast<SituacaoEnumeracao>(indiceSituacao);
+
+    profundidade = static_cast<int>(caminho.size()) - 1;
+    for (int k = 0; k < profundidade; k++) {
+        char c = caminho[k + 1];
+        if (c < '1' || c > '9') {
+            return false;
+        }
+        digitos[k] = static_cast<uint8_t>(c - '0');
+    }
+    return true;
+}
+
+// ---------------------------------------------------------------------------
+// Enumerador
+
+// Construtor
+EnumeradorSolucoes::EnumeradorSolucoes(const Tabuleiro& tabuleiro)
+    : inicial(tabuleiro), profundidade(0), entregues(0),
+      situacao(SituacaoEnumeracao::NAO_INICIADA), valido(true) {
+    if (!estado.iniciar(tabuleiro)) {
+        situacao = SituacaoEnumeracao::TERMINADA;   // conflito: nenhuma solução
+    }
+}
+
+// Construtor a partir de um ponto de retomada: refaz as escolhas do caminho,
+// conferindo que cada dígito era um candidato do seu nível
+EnumeradorSolucoes::EnumeradorSolucoes(const PontoRetomada& ponto)
+    : inicial(ponto.tabuleiro), profundidade(0), entregues(ponto.entregues),
+      situacao(ponto.situacao), valido(true) {
+    bool consistente = estado.iniciar(inicial);
+
+    for (int k = 0; k < ponto.profundidade && valido; k++) {
+        uint16_t cand;
+        int posicao = consistente && k < estado.numVazias ? estado.escolher(k, cand) : -1;
+        uint16_t bit = static_cast<uint16_t>(1u << (ponto.digitos[k] - 1));
+        if (posicao < 0 || !(cand & bit)) {
+            valido = false;
+        } else {
+            descer(posicao, cand, bit);
+        }
+    }
+
+    // O caminho tem de parar em uma solução (ou ser vazio antes do início)
+    switch (situacao) {
+        case SituacaoEnumeracao::NAO_INICIADA:
+            valido = valido && ponto.profundidade == 0 && entregues == 0;
+            if (!consistente) {
+                situacao = SituacaoEnumeracao::TERMINADA;
+            }
+            break;
+        case SituacaoEnumeracao::APOS_SOLUCAO:
+            valido = valido && consistente && profundidade == estado.numVazias;
+            break;
+        case SituacaoEnumeracao::TERMINADA:
+            break;
+    }
+
+    if (!valido) {
+        situacao = SituacaoEnumeracao::TERMINADA;
+    }
+}
+
+void EnumeradorSolucoes::descer(int posicao, uint16_t cand, uint16_t bit) {
+    Nivel& nivel = pilha[profundidade];
+    nivel.celula = estado.vazias[posicao];
+    nivel.posicao = static_cast<uint8_t>(posicao);
+    nivel.atual = bit;
+    nivel.restantes = cand & ~(bit | (bit - 1));
+
+    // Mesma troca da busca recursiva: a célula escolhida vai para a posição do nível
+    estado.vazias[posicao] = estado.vazias[profundidade];
+    estado.vazias[profundidade] = nivel.celula;
+    estado.alternar(nivel.celula, bit);
+    profundidade++;
+}
+
+bool EnumeradorSolucoes::retroceder() {
+    while (profundidade > 0) {
+        Nivel& nivel = pilha[profundidade - 1];
+        estado.alternar(nivel.celula, nivel.atual);
+
+        if (nivel.restantes) {
+            nivel.atual = nivel.restantes & -nivel.restantes;
+            nivel.restantes ^= nivel.atual;
+            estado.alternar(nivel.celula, nivel.atual);
+            return true;
+        }
+
+        // Nível esgotado: desfaz a troca e sobe
+        estado.vazias[profundidade - 1] = estado.vazias[nivel.posicao];
+        estado.vazias[nivel.posicao] = nivel.celula;
+        profundidade--;
+    }
+    return false;
+}
+
+bool EnumeradorSolucoes::proxima(Tabuleiro& solucao) {
+    if (situacao == SituacaoEnumeracao::TERMINADA) {
+        return false;
+    }
+    if (situacao == SituacaoEnumeracao::APOS_SOLUCAO && !retroceder()) {
+        situacao = SituacaoEnumeracao::TERMINADA;
+        return false;
+    }
+
+    // Desce até completar o tabuleiro, voltando nos ramos sem saída
+    while (profundidade < estado.numVazias) {
+        uint16_t cand;
+        int posicao = estado.escolher(profundidade, cand);
+        if (posicao >= 0) {
+            descer(posicao, cand, cand & -cand);
+        } else if (!retroceder()) {
+            situacao = SituacaoEnumeracao::TERMINADA;
+            return false;
+        }
+    }
+
+    memcpy(solucao.celulas, estado.valor, NUM_CELULAS);
+    entregues++;
+    situacao = SituacaoEnumeracao::APOS_SOLUCAO;
+    return true;
+}
+
+PontoRetomada EnumeradorSolucoes::pontoRetomada() const {
+    PontoRetomada ponto;
+    ponto.tabuleiro = inicial;
+    ponto.entregues = entregues;
+    ponto.situacao = situacao;
+
+    // Terminada não precisa de caminho; nos outros casos é a pilha atual
+    ponto.profundidade = situacao == SituacaoEnumeracao::TERMINADA ? 0 : profundidade;
+    for (int k = 0; k < ponto.profundidade; k++) {
+        ponto.digitos[k] = static_cast<uint8_t>(__builtin_ctz(pilha[k].atual) + 1);
+    }
+    return ponto;
+}
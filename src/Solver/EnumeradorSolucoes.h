@@ -0,0 +1,124 @@
+#ifndef ENUMERADORSOLUCOES_H
+#define ENUMERADORSOLUCOES_H
+
+#include <cstdint>
+#include <iterator>
+#include <string>
+#include "../Tabuleiro/Tabuleiro.h"
+#include "EstadoMascaras.h"
+
+// Situação de uma enumeração entre duas chamadas a proxima()
+enum class SituacaoEnumeracao {
+    NAO_INICIADA,   // nenhuma solução pedida ainda
+    APOS_SOLUCAO,   // a última chamada entregou uma solução
+    TERMINADA       // todas as soluções foram entregues
+};
+
+// Ponto de retomada de uma enumeração: o tabuleiro de partida e o dígito
+// escolhido em cada nível do caminho até a última solução entregue. Como a
+// escolha da célula de cada nível é determinística, isso basta para
+// reconstruir a pilha da busca. Em texto, uma linha:
+//   <tabuleiro, 81 caracteres> <soluções entregues> <i|s|t><dígitos do caminho>
+// com i = não iniciada, s = após solução e t = terminada.
+struct PontoRetomada {
+    Tabuleiro tabuleiro;
+    long long entregues;
+    SituacaoEnumeracao situacao;
+    int profundidade;
+    uint8_t digitos[NUM_CELULAS];
+
+    std::string paraTexto() const;
+
+    // Retorna false se o texto estiver mal formado
+    bool carregarTexto(const std::string& texto);
+};
+
+// Enumerador preguiçoso das soluções de um tabuleiro.
+// Cada chamada a proxima() continua a busca de onde a anterior parou e
+// entrega uma solução. A busca é a do contador de soluções (mesma árvore e
+// mesma ordem), mas com pilha explícita em vez de recursão: o estado é só o
+// objeto (~800 bytes), qualquer que seja o número de soluções, e pode ser
+// salvo em um PontoRetomada para continuar mais tarde, até em outro processo.
+//
+// Uso:
+//   EnumeradorSolucoes e(tabuleiro);
+//   Tabuleiro s;
+//   while (e.proxima(s)) { ... }
+// ou, com o iterador de entrada: for (const Tabuleiro& s : e) { ... }
+class EnumeradorSolucoes {
+public:
+    // Enumera as soluções do tabuleiro (nenhuma, se ele já tiver conflitos)
+    explicit EnumeradorSolucoes(const Tabuleiro& tabuleiro);
+
+    // Retoma a enumeração do ponto salvo. Se o ponto não corresponder a uma
+    // busca deste tabuleiro, isValido() retorna false e não há mais soluções.
+    explicit EnumeradorSolucoes(const PontoRetomada& ponto);
+
+    bool isValido() const { return valido; }
+
+    // Escreve a próxima solução em 'solucao'; false quando não há mais
+    bool proxima(Tabuleiro& solucao);
+
+    // Soluções entregues desde o início (contando as de antes da retomada)
+    long long getEntregues() const { return entregues; }
+
+    bool terminou() const { return situacao == SituacaoEnumeracao::TERMINADA; }
+
+    // Ponto para continuar depois da última solução entregue
+    PontoRetomada pontoRetomada() const;
+
+    // Iterador de entrada: avançar pede a próxima solução ao enumerador, então
+    // um laço interrompido depois de k soluções consome exatamente k.
+    class Iterador : public std::iterator<std::input_iterator_tag, Tabuleiro> {
+    public:
+        explicit Iterador(EnumeradorSolucoes* enumerador) : enumerador(enumerador) { avancar(); }
+
+        const Tabuleiro& operator*() const { return atual; }
+        const Tabuleiro* operator->() const { return &atual; }
+        Iterador& operator++() { avancar(); return *this; }
+
+        bool operator==(const Iterador& outro) const { return enumerador == outro.enumerador; }
+        bool operator!=(const Iterador& outro) const { return enumerador != outro.enumerador; }
+
+    private:
+        EnumeradorSolucoes* enumerador;   // nullptr no fim
+        Tabuleiro atual;
+
+        void avancar() {
+            if (enumerador && !enumerador->proxima(atual)) {
+                enumerador = nullptr;
+            }
+        }
+    };
+
+    // Continua de onde a enumeração está (não recomeça)
+    Iterador begin() { return Iterador(this); }
+    Iterador end() { return Iterador(nullptr); }
+
+private:
+    // Nível da pilha: a célula ramificada, sua posição original em 'vazias'
+    // e os dígitos atual e ainda não tentados
+    struct Nivel {
+        uint8_t celula;
+        uint8_t posicao;
+        uint16_t atual;
+        uint16_t restantes;
+    };
+
+    Tabuleiro inicial;
+    EstadoMascaras estado;
+    Nivel pilha[NUM_CELULAS];
+    int profundidade;
+    long long entregues;
+    SituacaoEnumeracao situacao;
+    bool valido;
+
+    // Atribui 'bit' na célula da posição 'posicao' de 'vazias', dentre os
+    // candidatos 'cand' (os dígitos maiores ficam para os próximos ramos)
+    void descer(int posicao, uint16_t cand, uint16_t bit);
+
+    // Passa para o próximo ramo ainda não tentado; false se a busca acabou
+    bool retroceder();
+};
+
+#endif // ENUMERADORSOLUCOES_H
@@ -0,0 +1,139 @@
+#ifndef ESTADOMASCARAS_H
+#define ESTADOMASCARAS_H
+
+#include <cstdint>
+#include "../Tabuleiro/Tabuleiro.h"
+
+// Estado de uma busca em máscaras de bits, compartilhado pelo contador de
+// soluções (sequencial e paralelo) e pelo enumerador: máscaras de dígitos
+// usados por linha/coluna/bloco e a lista das células vazias, reordenada no
+// lugar conforme a busca desce. A escolha da célula em cada nível depende
+// só deste estado, então as três buscas percorrem a mesma árvore.
+struct EstadoMascaras {
+    static const uint16_t TODOS_DIGITOS = 0x1FF;
+
+    uint16_t linha[9];
+    uint16_t coluna[9];
+    uint16_t bloco[9];
+    uint8_t valor[81];      // 0 = vazia, para os hidden singles
+    uint8_t vazias[81];
+    int numVazias;
+
+    uint16_t candidatos(int indice) const {
+        return ~(linha[LINHA_DA_CELULA[indice]] |
+                 coluna[COLUNA_DA_CELULA[indice]] |
+                 bloco[BLOCO_DA_CELULA[indice]]) & TODOS_DIGITOS;
+    }
+
+    uint16_t usadoNaUnidade(int unidade) const {
+        return unidade < 9 ? linha[unidade] : unidade < 18 ? coluna[unidade - 9] : bloco[unidade - 18];
+    }
+
+    void alternar(int indice, uint16_t bit) {
+        linha[LINHA_DA_CELULA[indice]] ^= bit;
+        coluna[COLUNA_DA_CELULA[indice]] ^= bit;
+        bloco[BLOCO_DA_CELULA[indice]] ^= bit;
+        valor[indice] = valor[indice] ? 0 : static_cast<uint8_t>(__builtin_ctz(bit) + 1);
+    }
+
+    // Procura um dígito que só cabe em uma célula de alguma unidade.
+    // Retorna a posição da célula em 'vazias' (e o dígito em 'cand'),
+    // -1 se não houver hidden single ou -2 se algum dígito não couber em lugar nenhum.
+    int procurarHiddenSingle(int n, uint16_t& cand) const {
+        for (int u = 0; u < 27; u++) {
+            const uint8_t* unidade = CELULAS_DA_UNIDADE[u];
+            uint16_t umaVez = 0;
+            uint16_t duasVezes = 0;
+            for (int p = 0; p < 9; p++) {
+                if (valor[unidade[p]] != 0) continue;
+                uint16_t c = candidatos(unidade[p]);
+                duasVezes |= umaVez & c;
+                umaVez |= c;
+            }
+
+            uint16_t faltando = ~usadoNaUnidade(u) & TODOS_DIGITOS;
+            if ((umaVez & faltando) != faltando) {
+                return -2;
+            }
+
+            uint16_t unicos = umaVez & ~duasVezes;
+            if (unicos) {
+                uint16_t bit = unicos & -unicos;
+                for (int p = 0; p < 9; p++) {
+                    int indice = unidade[p];
+                    if (valor[indice] == 0 && (candidatos(indice) & bit)) {
+                        for (int k = n; k < numVazias; k++) {
+                            if (vazias[k] == indice) {
+                                cand = bit;
+                                return k;
+                            }
+                        }
+                    }
+                }
+            }
+        }
+        return -1;
+    }
+
+    // Monta as máscaras a partir do tabuleiro; false se já houver dígito repetido
+    bool iniciar(const Tabuleiro& tabuleiro) {
+        for (int i = 0; i < 9; i++) {
+            linha[i] = coluna[i] = bloco[i] = 0;
+        }
+        numVazias = 0;
+
+        for (int i = 0; i < 81; i++) {
+            int valor = tabuleiro.celulas[i];
+            this->valor[i] = 0;
+            if (valor == 0) {
+                vazias[numVazias++] = static_cast<uint8_t>(i);
+                continue;
+            }
+
+            uint16_t bit = static_cast<uint16_t>(1u << (valor - 1));
+            if (candidatos(i) & bit) {
+                alternar(i, bit);
+            } else {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // Escolhe a célula em que o nível n ramifica: retorna sua posição em
+    // 'vazias' (candidatos em 'candMelhor') ou -1 se o ramo não tem solução
+    int escolher(int n, uint16_t& candMelhor) const {
+        // MRV: traz para a posição n a vazia com menos candidatos
+        int melhor = n;
+        candMelhor = candidatos(vazias[n]);
+        int menor = __builtin_popcount(candMelhor);
+        for (int k = n + 1; k < numVazias && menor > 1; k++) {
+            uint16_t cand = candidatos(vazias[k]);
+            int qtd = __builtin_popcount(cand);
+            if (qtd < menor) {
+                menor = qtd;
+                melhor = k;
+                candMelhor = cand;
+            }
+        }
+
+        if (menor == 0) {
+            return -1;
+        }
+
+        // Sem naked single: procurar um hidden single (dígito com um só lugar
+        // em alguma unidade), que vira um ramo único
+        if (menor > 1) {
+            int forcado = procurarHiddenSingle(n, candMelhor);
+            if (forcado == -2) {
+                return -1;
+            }
+            if (forcado >= 0) {
+                melhor = forcado;
+            }
+        }
+        return melhor;
+    }
+};
+
+#endif // ESTADOMASCARAS_H
@@ -0,0 +1,15 @@
+#ifndef ESTATISTICASSOLVER_H
+#define ESTATISTICASSOLVER_H
+
+#include <chrono>
+
+// Struct para armazenar estatísticas de uma resolução (comum a todos os motores)
+struct EstatisticasSolver {
+    long long nosVisitados;          // nós da árvore de busca
+    long long retrocessos;           // ramos descartados (backtracking)
+    long long celulasPropagadas;     // células preenchidas por propagação (singles)
+    std::chrono::nanoseconds tempoEmNs;
+    bool resolvido;
+};
+
+#endif // ESTATISTICASSOLVER_H
@@ -0,0 +1,78 @@
+#include "SolverBacktracking.h"
+#include <chrono>
+
+using namespace std;
+
+// Construtor
+SolverBacktracking::SolverBacktracking(uint64_t semente)
+    : rng(semente), limiteNos(0), interrompido(false) {
+    stats.nosVisitados = 0;
+    stats.retrocessos = 0;
+    stats.celulasPropagadas = 0;
+    stats.tempoEmNs = chrono::nanoseconds(0);
+    stats.resolvido = false;
+}
+
+bool SolverBacktracking::resolver(Tabuleiro& tabuleiro) {
+    auto inicio = chrono::high_resolution_clock::now();
+    stats.nosVisitados = 0;
+    stats.retrocessos = 0;
+    interrompido = false;
+
+    // Em caso de falha cada célula tentada volta a 0: o tabuleiro fica como estava
+    stats.resolvido = preencher(tabuleiro, 0);
+    stats.tempoEmNs = chrono::duration_cast<chrono::nanoseconds>(
+        chrono::high_resolution_clock::now() - inicio);
+    return stats.resolvido;
+}
+
+const EstatisticasSolver& SolverBacktracking::getEstatisticas() const {
+    return stats;
+}
+
+// Preenche a partir da célula 'indice' (linha a linha)
+bool SolverBacktracking::preencher(Tabuleiro& tabuleiro, int indice) {
+    stats.nosVisitados++;
+    if (limiteNos > 0 && stats.nosVisitados > limiteNos) {
+        interrompido = true;
+        return false;
+    }
+
+    // Se chegamos ao final do tabuleiro, retornamos true
+    if (indice == NUM_CELULAS) {
+        return true;
+    }
+
+    // Se a célula já tem um valor, vamos para a próxima
+    if (tabuleiro.celulas[indice] != 0) {
+        return preencher(tabuleiro, indice + 1);
+    }
+
+    // Tentar valores de 1 a 9 em ordem aleatória
+    int values[LADO_TABULEIRO];
+    for (int v = 0; v < LADO_TABULEIRO; v++) {
+        values[v] = v + 1;
+    }
+    rng.embaralhar(values, LADO_TABULEIRO);
+
+    int row = LINHA_DA_CELULA[indice];
+    int col = COLUNA_DA_CELULA[indice];
+    for (int val : values) {
+        if (tabuleiro.podeColocar(row, col, val)) {
+            tabuleiro.celulas[indice] = static_cast<uint8_t>(val);
+
+            if (preencher(tabuleiro, indice + 1)) {
+                return true;
+            }
+
+            // Se não conseguimos preencher, voltamos atrás
+            tabuleiro.celulas[indice] = 0;
+            if (interrompido) {
+                return false;
+            }
+            stats.retrocessos++;
+        }
+    }
+
+    return false;
+}
@@ -0,0 +1,39 @@
+#ifndef SOLVERBACKTRACKING_H
+#define SOLVERBACKTRACKING_H
+
+#include <cstdint>
+#include "../Tabuleiro/Tabuleiro.h"
+#include "../Gerador/Xoshiro.h"
+#include "EstatisticasSolver.h"
+
+// Solver por backtracking simples (o motor original do jogo).
+// Percorre as células em ordem de linhas e tenta os dígitos em ordem
+// aleatória em cada célula vazia, sem propagação. Serve de referência para
+// os outros motores e para gerar soluções completas aleatórias.
+class SolverBacktracking {
+public:
+    explicit SolverBacktracking(uint64_t semente);
+
+    // Limite de nós por chamada (0 = sem limite). Ao atingi-lo a busca para,
+    // resolver() retorna false sem alterar o tabuleiro e foiInterrompido()
+    // retorna true.
+    void setLimiteNos(long long limite) { limiteNos = limite; }
+    bool foiInterrompido() const { return interrompido; }
+
+    // Resolve o tabuleiro no lugar. Se não houver solução retorna false e o
+    // tabuleiro não é alterado.
+    bool resolver(Tabuleiro& tabuleiro);
+
+    // Estatísticas da última chamada a resolver()
+    const EstatisticasSolver& getEstatisticas() const;
+
+private:
+    EstatisticasSolver stats;
+    Xoshiro256 rng;
+    long long limiteNos;
+    bool interrompido;
+
+    bool preencher(Tabuleiro& tabuleiro, int indice);
+};
+
+#endif // SOLVERBACKTRACKING_H
@@ -0,0 +1,223 @@
+#include "SolverDLX.h"
+#include <chrono>
+#include "../Trace/Rastreador.h"
+
+using namespace std;
+
+// Construtor - monta a matriz de cobertura exata completa uma única vez
+SolverDLX::SolverDLX()
+    : numSolucao(0), solucoesEncontradas(0), limiteSolucoes(1), interrompido(false) {
+    // Raiz (0) e cabeçalhos de coluna (1-324) em uma lista circular horizontal
+    for (int c = 0; c <= NUM_COLUNAS; c++) {
+        nos[c].esquerda = static_cast<uint16_t>(c == 0 ? NUM_COLUNAS : c - 1);
+        nos[c].direita = static_cast<uint16_t>(c == NUM_COLUNAS ? 0 : c + 1);
+        nos[c].cima = nos[c].baixo = static_cast<uint16_t>(c);
+        nos[c].coluna = static_cast<uint16_t>(c);
+        nos[c].linha = 0;
+        tamanho[c] = 0;
+    }
+
+    // Uma linha por par (célula, dígito), com um nó em cada uma das 4 restrições
+    int proximo = 1 + NUM_COLUNAS;
+    for (int linha = 0; linha < NUM_LINHAS; linha++) {
+        int celula = linha / 9;
+        int digito = linha % 9;
+        int colunas[4] = {
+            1 + celula,
+            1 + 81 + LINHA_DA_CELULA[celula] * 9 + digito,
+            1 + 162 + COLUNA_DA_CELULA[celula] * 9 + digito,
+            1 + 243 + BLOCO_DA_CELULA[celula] * 9 + digito
+        };
+
+        int primeiro = proximo;
+        for (int k = 0; k < 4; k++) {
+            int n = proximo++;
+            int c = colunas[k];
+
+            // Inserir no fim da coluna
+            nos[n].coluna = static_cast<uint16_t>(c);
+            nos[n].linha = static_cast<uint16_t>(linha);
+            nos[n].baixo = static_cast<uint16_t>(c);
+            nos[n].cima = nos[c].cima;
+            nos[nos[c].cima].baixo = static_cast<uint16_t>(n);
+            nos[c].cima = static_cast<uint16_t>(n);
+            tamanho[c]++;
+
+            // Anel horizontal com os outros nós da linha
+            nos[n].esquerda = static_cast<uint16_t>(k == 0 ? primeiro + 3 : n - 1);
+            nos[n].direita = static_cast<uint16_t>(k == 3 ? primeiro : n + 1);
+        }
+    }
+
+    stats.nosVisitados = 0;
+    stats.retrocessos = 0;
+    stats.celulasPropagadas = 0;
+    stats.tempoEmNs = chrono::nanoseconds(0);
+    stats.resolvido = false;
+}
+
+const EstatisticasSolver& SolverDLX::getEstatisticas() const {
+    return stats;
+}
+
+// Remove a coluna do cabeçalho e todas as linhas que a satisfazem
+void SolverDLX::cobrir(int coluna) {
+    nos[nos[coluna].direita].esquerda = nos[coluna].esquerda;
+    nos[nos[coluna].esquerda].direita = nos[coluna].direita;
+
+    for (int i = nos[coluna].baixo; i != coluna; i = nos[i].baixo) {
+        for (int j = nos[i].direita; j != i; j = nos[j].direita) {
+            nos[nos[j].baixo].cima = nos[j].cima;
+            nos[nos[j].cima].baixo = nos[j].baixo;
+            tamanho[nos[j].coluna]--;
+        }
+    }
+}
+
+// Desfaz cobrir() na ordem inversa - os "dancing links"
+void SolverDLX::descobrir(int coluna) {
+    for (int i = nos[coluna].cima; i != coluna; i = nos[i].cima) {
+        for (int j = nos[i].esquerda; j != i; j = nos[j].esquerda) {
+            tamanho[nos[j].coluna]++;
+            nos[nos[j].baixo].cima = static_cast<uint16_t>(j);
+            nos[nos[j].cima].baixo = static_cast<uint16_t>(j);
+        }
+    }
+
+    nos[nos[coluna].direita].esquerda = static_cast<uint16_t>(coluna);
+    nos[nos[coluna].esquerda].direita = static_cast<uint16_t>(coluna);
+}
+
+// Algorithm X: escolhe a coluna com menos linhas e tenta cada uma delas.
+// Retorna true quando o limite de soluções foi atingido ou a parada foi pedida.
+bool SolverDLX::buscar(int profundidade) {
+    stats.nosVisitados++;
+
+    if ((stats.nosVisitados & 255) == 0 && token.paradaSolicitada()) {
+        interrompido = true;
+    }
+    if (interrompido) {
+        return true;
+    }
+
+    if (nos[0].direita == 0) {
+        if (solucoesEncontradas == 0) {
+            for (int k = 0; k < profundidade; k++) {
+                solucao[k] = escolhidas[k];
+            }
+            numSolucao = profundidade;
+        }
+        solucoesEncontradas++;
+        return solucoesEncontradas >= limiteSolucoes;
+    }
+
+    int coluna = nos[0].direita;
+    for (int c = nos[0].direita; c != 0 && tamanho[coluna] > 1; c = nos[c].direita) {
+        if (tamanho[c] < tamanho[coluna]) {
+            coluna = c;
+        }
+    }
+
+    if (tamanho[coluna] == 0) {
+        return false;
+    }
+
+    cobrir(coluna);
+
+    bool parar = false;
+    for (int r = nos[coluna].baixo; r != coluna && !parar; r = nos[r].baixo) {
+        escolhidas[profundidade] = nos[r].linha;
+        for (int j = nos[r].direita; j != r; j = nos[j].direita) {
+            cobrir(nos[j].coluna);
+        }
+
+        parar = buscar(profundidade + 1);
+
+        for (int j = nos[r].esquerda; j != r; j = nos[j].esquerda) {
+            descobrir(nos[j].coluna);
+        }
+        if (!parar) {
+            stats.retrocessos++;
+        }
+    }
+
+    descobrir(coluna);
+    return parar;
+}
+
+int SolverDLX::aplicarPistas(const Tabuleiro& tabuleiro, uint16_t* pistas) {
+    int numPistas = 0;
+
+    for (int i = 0; i < 81; i++) {
+        int valor = tabuleiro.celulas[i];
+        if (valor == 0) continue;
+
+        int primeiro = 1 + NUM_COLUNAS + (i * 9 + valor - 1) * 4;
+
+        // Uma coluna já coberta significa duas pistas na mesma restrição
+        for (int k = 0; k < 4; k++) {
+            int c = nos[primeiro + k].coluna;
+            if (nos[nos[c].direita].esquerda != c) {
+                removerPistas(pistas, numPistas);
+                return -1;
+            }
+        }
+
+        for (int k = 0; k < 4; k++) {
+            cobrir(nos[primeiro + k].coluna);
+        }
+        pistas[numPistas++] = static_cast<uint16_t>(primeiro);
+    }
+
+    return numPistas;
+}
+
+void SolverDLX::removerPistas(const uint16_t* pistas, int numPistas) {
+    for (int p = numPistas - 1; p >= 0; p--) {
+        for (int k = 3; k >= 0; k--) {
+            descobrir(nos[pistas[p] + k].coluna);
+        }
+    }
+}
+
+int SolverDLX::executar(const Tabuleiro& tabuleiro, int limite, Tabuleiro* saida) {
+    RASTREAR("SolverDLX::executar", "solver");
+    auto inicio = chrono::high_resolution_clock::now();
+
+    stats.nosVisitados = 0;
+    stats.retrocessos = 0;
+    stats.celulasPropagadas = 0;
+    solucoesEncontradas = 0;
+    numSolucao = 0;
+    limiteSolucoes = limite;
+    interrompido = false;
+
+    uint16_t pistas[81];
+    int numPistas = aplicarPistas(tabuleiro, pistas);
+    if (numPistas >= 0) {
+        if (limite > 0) {
+            buscar(0);
+        }
+        removerPistas(pistas, numPistas);
+    }
+
+    if (saida && solucoesEncontradas > 0) {
+        *saida = tabuleiro;
+        for (int k = 0; k < numSolucao; k++) {
+            saida->celulas[solucao[k] / 9] = static_cast<uint8_t>(solucao[k] % 9 + 1);
+        }
+    }
+
+    stats.resolvido = solucoesEncontradas > 0;
+    stats.tempoEmNs = chrono::duration_cast<chrono::nanoseconds>(
+        chrono::high_resolution_clock::now() - inicio);
+    return solucoesEncontradas;
+}
+
+bool SolverDLX::resolver(Tabuleiro& tabuleiro) {
+    return executar(tabuleiro, 1, &tabuleiro) > 0;
+}
+
+int SolverDLX::contarSolucoes(const Tabuleiro& tabuleiro, int limite) {
+    return executar(tabuleiro, limite, nullptr);
+}
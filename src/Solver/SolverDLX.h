@@ -0,0 +1,70 @@
+#ifndef SOLVERDLX_H
+#define SOLVERDLX_H
+
+#include <cstdint>
+#include "../Tabuleiro/Tabuleiro.h"
+#include "../ThreadPool/TokenParada.h"
+#include "EstatisticasSolver.h"
+
+// Solver por cobertura exata (Algorithm X com Dancing Links).
+// O Sudoku vira uma matriz de 729 linhas (célula x dígito) por 324 restrições:
+// célula preenchida, dígito na linha, dígito na coluna e dígito no bloco.
+// Todos os nós ficam em um vetor pré-alocado dentro do objeto, montado uma
+// única vez no construtor: a busca não faz nenhuma alocação, e cada chamada
+// desfaz suas coberturas ao terminar, deixando a estrutura pronta para a próxima.
+class SolverDLX {
+public:
+    SolverDLX();
+
+    // Resolve o tabuleiro no lugar. Se não houver solução retorna false e o
+    // tabuleiro não é alterado.
+    bool resolver(Tabuleiro& tabuleiro);
+
+    // Conta as soluções do tabuleiro, parando ao atingir 'limite'
+    int contarSolucoes(const Tabuleiro& tabuleiro, int limite);
+
+    // Estatísticas da última chamada a resolver() ou contarSolucoes()
+    const EstatisticasSolver& getEstatisticas() const;
+
+    // Token de parada, consultado a cada 256 nós. Ao ser acionado a busca
+    // desfaz suas coberturas e retorna; foiInterrompido() indica se a última
+    // chamada terminou assim (o resultado então não é conclusivo).
+    void setTokenParada(const TokenParada& token) { this->token = token; }
+    bool foiInterrompido() const { return interrompido; }
+
+private:
+    static const int NUM_COLUNAS = 324;
+    static const int NUM_LINHAS = 729;
+    static const int NUM_NOS = 1 + NUM_COLUNAS + NUM_LINHAS * 4;
+
+    // Nó da lista duplamente ligada em quatro direções (índices no vetor 'nos')
+    struct No {
+        uint16_t esquerda, direita, cima, baixo;
+        uint16_t coluna;   // cabeçalho da coluna do nó
+        uint16_t linha;    // linha da matriz (célula * 9 + dígito - 1)
+    };
+
+    No nos[NUM_NOS];
+    int tamanho[1 + NUM_COLUNAS];      // nós ativos em cada coluna
+    uint16_t escolhidas[81];           // linhas da solução parcial
+    uint16_t solucao[81];              // linhas da primeira solução encontrada
+    int numSolucao;
+    int solucoesEncontradas;
+    int limiteSolucoes;
+    EstatisticasSolver stats;
+    TokenParada token;
+    bool interrompido;
+
+    void cobrir(int coluna);
+    void descobrir(int coluna);
+    bool buscar(int profundidade);
+
+    // Cobre as linhas das pistas; retorna quantas foram cobertas ou -1 se há conflito
+    int aplicarPistas(const Tabuleiro& tabuleiro, uint16_t* pistas);
+    void removerPistas(const uint16_t* pistas, int numPistas);
+
+    // Executa a busca completa a partir do tabuleiro
+    int executar(const Tabuleiro& tabuleiro, int limite, Tabuleiro* saida);
+};
+
+#endif // SOLVERDLX_H
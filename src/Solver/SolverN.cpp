@@ -0,0 +1,272 @@
+#include "SolverN.h"
+#include "SolverPropagacao.h"
+#include "ContadorSolucoes.h"
+#include <chrono>
+
+using namespace std;
+
+// Construtor
+template <int B>
+SolverPropagacaoN<B>::SolverPropagacaoN()
+    : aleatorio(false), rng(0), limite(1), encontradas(0), limiteNos(0), interrompido(false),
+      saida(nullptr) {
+    stats.nosVisitados = 0;
+    stats.retrocessos = 0;
+    stats.celulasPropagadas = 0;
+    stats.tempoEmNs = chrono::nanoseconds(0);
+    stats.resolvido = false;
+}
+
+template <int B>
+void SolverPropagacaoN<B>::setAleatorio(bool ativo, uint64_t semente) {
+    aleatorio = ativo;
+    rng.semear(semente);
+}
+
+template <int B>
+bool SolverPropagacaoN<B>::resolver(TabuleiroN<B>& tabuleiro) {
+    return executar(tabuleiro, 1, &tabuleiro) > 0;
+}
+
+template <int B>
+int SolverPropagacaoN<B>::contarSolucoes(const TabuleiroN<B>& tabuleiro, int limite) {
+    return executar(tabuleiro, limite, nullptr);
+}
+
+template <int B>
+int SolverPropagacaoN<B>::executar(const T& tabuleiro, int limiteSolucoes, T* destino) {
+    auto inicio = chrono::high_resolution_clock::now();
+
+    stats.nosVisitados = 0;
+    stats.retrocessos = 0;
+    stats.celulasPropagadas = 0;
+    limite = limiteSolucoes;
+    encontradas = 0;
+    interrompido = false;
+    saida = destino;
+
+    if (pilha.empty()) {
+        pilha.emplace_back();
+    }
+    if (limite > 0 && montar(tabuleiro, pilha[0])) {
+        buscar(0);
+    }
+
+    stats.resolvido = encontradas > 0;
+    stats.tempoEmNs = chrono::duration_cast<chrono::nanoseconds>(
+        chrono::high_resolution_clock::now() - inicio);
+    return encontradas;
+}
+
+// Monta o estado inicial; retorna false se o tabuleiro já tem conflitos
+template <int B>
+bool SolverPropagacaoN<B>::montar(const T& tabuleiro, Estado& e) {
+    memcpy(e.celulas, tabuleiro.celulas, sizeof(e.celulas));
+    memset(e.usado, 0, sizeof(e.usado));
+    e.vazias = 0;
+
+    for (int i = 0; i < T::NUM_CELULAS; i++) {
+        int valor = e.celulas[i];
+        if (valor == 0) {
+            e.vazias++;
+            continue;
+        }
+        if (valor > T::LADO) {
+            return false;
+        }
+        Mascara bit = T::bitDoValor(valor);
+        int unidades[3] = { T::linhaDa(i), T::LADO + T::colunaDa(i), 2 * T::LADO + T::blocoDa(i) };
+        for (int u : unidades) {
+            if (e.usado[u] & bit) {
+                return false;
+            }
+            e.usado[u] |= bit;
+        }
+    }
+    return true;
+}
+
+namespace {
+
+// Candidatos de uma célula: dígitos ausentes da sua linha, coluna e bloco
+template <int B>
+inline typename TabuleiroN<B>::Mascara candidatosDeN(const typename TabuleiroN<B>::Mascara* usado, int indice) {
+    typedef TabuleiroN<B> T;
+    return static_cast<typename T::Mascara>(
+        ~(usado[T::linhaDa(indice)] | usado[T::LADO + T::colunaDa(indice)] |
+          usado[2 * T::LADO + T::blocoDa(indice)]) & T::todosDigitos());
+}
+
+// Coloca o dígito representado por 'bit' na célula e o marca nas três unidades
+template <int B>
+inline void atribuirN(uint8_t* celulas, typename TabuleiroN<B>::Mascara* usado, int& vazias,
+                      int indice, typename TabuleiroN<B>::Mascara bit) {
+    typedef TabuleiroN<B> T;
+    celulas[indice] = static_cast<uint8_t>(__builtin_ctzll(bit) + 1);
+    usado[T::linhaDa(indice)] |= bit;
+    usado[T::LADO + T::colunaDa(indice)] |= bit;
+    usado[2 * T::LADO + T::blocoDa(indice)] |= bit;
+    vazias--;
+}
+
+} // namespace
+
+// Aplica naked singles e hidden singles até não haver mais mudanças.
+// Retorna false se encontrar uma contradição.
+template <int B>
+bool SolverPropagacaoN<B>::propagar(Estado& e) {
+    bool mudou = true;
+    while (mudou && e.vazias > 0) {
+        mudou = false;
+
+        // Naked singles: célula com um único candidato
+        for (int i = 0; i < T::NUM_CELULAS; i++) {
+            if (e.celulas[i] != 0) continue;
+            Mascara cand = candidatosDeN<B>(e.usado, i);
+            if (cand == 0) {
+                return false;
+            }
+            if ((cand & (cand - 1)) == 0) {
+                atribuirN<B>(e.celulas, e.usado, e.vazias, i, cand);
+                stats.celulasPropagadas++;
+                mudou = true;
+            }
+        }
+
+        // Hidden singles: dígito com um único lugar possível na unidade
+        for (int u = 0; u < T::NUM_UNIDADES; u++) {
+            Mascara umaVez = 0;
+            Mascara duasVezes = 0;
+            for (int p = 0; p < T::LADO; p++) {
+                int i = T::celulaDaUnidade(u, p);
+                if (e.celulas[i] != 0) continue;
+                Mascara cand = candidatosDeN<B>(e.usado, i);
+                duasVezes |= umaVez & cand;
+                umaVez |= cand;
+            }
+
+            Mascara faltando = static_cast<Mascara>(~e.usado[u] & T::todosDigitos());
+            if ((umaVez & faltando) != faltando) {
+                return false; // algum dígito não cabe em lugar nenhum da unidade
+            }
+
+            Mascara unicos = static_cast<Mascara>(umaVez & ~duasVezes & faltando);
+            while (unicos) {
+                Mascara bit = static_cast<Mascara>(unicos & (~unicos + 1));
+                unicos &= unicos - 1;
+
+                bool colocado = false;
+                for (int p = 0; p < T::LADO && !colocado; p++) {
+                    int i = T::celulaDaUnidade(u, p);
+                    if (e.celulas[i] == 0 && (candidatosDeN<B>(e.usado, i) & bit)) {
+                        atribuirN<B>(e.celulas, e.usado, e.vazias, i, bit);
+                        colocado = true;
+                    }
+                }
+
+                if (colocado) {
+                    stats.celulasPropagadas++;
+                    mudou = true;
+                } else if (!(e.usado[u] & bit)) {
+                    return false; // o único lugar foi ocupado por outro hidden single
+                }
+            }
+        }
+    }
+    return true;
+}
+
+// Busca em profundidade com propagação a cada nó e ramificação MRV.
+// Retorna true quando o limite de soluções foi atingido.
+template <int B>
+bool SolverPropagacaoN<B>::buscar(int profundidade) {
+    stats.nosVisitados++;
+    if (limiteNos > 0 && stats.nosVisitados > limiteNos) {
+        interrompido = true;
+        return true;
+    }
+    Estado& e = pilha[profundidade];
+
+    if (!propagar(e)) {
+        return false;
+    }
+
+    if (e.vazias == 0) {
+        if (encontradas == 0 && saida) {
+            memcpy(saida->celulas, e.celulas, sizeof(e.celulas));
+        }
+        encontradas++;
+        return encontradas >= limite;
+    }
+
+    // Escolher a célula vazia com menos candidatos
+    int melhor = -1;
+    int menor = T::LADO + 1;
+    Mascara candMelhor = 0;
+    for (int i = 0; i < T::NUM_CELULAS && menor > 2; i++) {
+        if (e.celulas[i] != 0) continue;
+        Mascara cand = candidatosDeN<B>(e.usado, i);
+        int n = __builtin_popcountll(cand);
+        if (n < menor) {
+            menor = n;
+            melhor = i;
+            candMelhor = cand;
+        }
+    }
+
+    Mascara digitos[T::LADO];
+    int numDigitos = 0;
+    for (Mascara c = candMelhor; c; c &= c - 1) {
+        digitos[numDigitos++] = static_cast<Mascara>(c & (~c + 1));
+    }
+    if (aleatorio) {
+        rng.embaralhar(digitos, numDigitos);
+    }
+
+    // deque: acrescentar no fim não invalida a referência 'e'
+    if (static_cast<int>(pilha.size()) <= profundidade + 1) {
+        pilha.emplace_back();
+    }
+
+    for (int k = 0; k < numDigitos; k++) {
+        Estado& filho = pilha[profundidade + 1];
+        filho = e;
+        atribuirN<B>(filho.celulas, filho.usado, filho.vazias, melhor, digitos[k]);
+        if (buscar(profundidade + 1)) {
+            return true;
+        }
+        stats.retrocessos++;
+    }
+
+    return false;
+}
+
+// 9x9: mesmo layout de Tabuleiro, usa os motores com tabelas literais
+template <>
+bool SolverPropagacaoN<3>::resolver(TabuleiroN<3>& tabuleiro) {
+    Tabuleiro t;
+    memcpy(t.celulas, tabuleiro.celulas, sizeof(t.celulas));
+
+    SolverPropagacao solver;
+    solver.setAleatorio(aleatorio, rng());
+    bool resolvido = solver.resolver(t);
+    stats = solver.getEstatisticas();
+    if (resolvido) {
+        memcpy(tabuleiro.celulas, t.celulas, sizeof(t.celulas));
+    }
+    return resolvido;
+}
+
+template <>
+int SolverPropagacaoN<3>::contarSolucoes(const TabuleiroN<3>& tabuleiro, int limite) {
+    Tabuleiro t;
+    memcpy(t.celulas, tabuleiro.celulas, sizeof(t.celulas));
+    return ::contarSolucoes(t, limite);
+}
+
+// Instanciações explícitas dos tamanhos suportados
+template class SolverPropagacaoN<3>;
+template class SolverPropagacaoN<4>;
+template class SolverPropagacaoN<5>;
+template class SolverPropagacaoN<6>;
+template class SolverPropagacaoN<8>;
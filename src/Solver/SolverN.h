@@ -0,0 +1,72 @@
+#ifndef SOLVERN_H
+#define SOLVERN_H
+
+#include <cstdint>
+#include <deque>
+#include "../Tabuleiro/TabuleiroN.h"
+#include "../Gerador/Xoshiro.h"
+#include "EstatisticasSolver.h"
+
+// Solver por propagação de restrições para tabuleiros N x N.
+// Mesmo algoritmo de SolverPropagacao (naked/hidden singles até estabilizar e
+// ramificação MRV), com máscaras de N bits. Os estados da busca ficam em uma
+// pilha no heap reaproveitada entre chamadas: no 64x64 cada estado tem ~6KB e
+// a recursão na pilha do sistema não caberia.
+// Para B = 3 resolver() e contarSolucoes() delegam aos motores 9x9.
+template <int B>
+class SolverPropagacaoN {
+public:
+    SolverPropagacaoN();
+
+    // Ordem aleatória dos dígitos em cada ramificação
+    void setAleatorio(bool aleatorio, uint64_t semente);
+
+    // Resolve o tabuleiro no lugar. Se não houver solução retorna false e o
+    // tabuleiro não é alterado.
+    bool resolver(TabuleiroN<B>& tabuleiro);
+
+    // Conta as soluções do tabuleiro, parando ao atingir 'limite'
+    int contarSolucoes(const TabuleiroN<B>& tabuleiro, int limite = 2);
+
+    // Limite de nós por chamada (0 = sem limite). Ao atingi-lo a busca para e
+    // foiInterrompido() retorna true: a contagem deixa de ser conclusiva.
+    void setLimiteNos(long long limite) { limiteNos = limite; }
+    bool foiInterrompido() const { return interrompido; }
+
+    // Estatísticas da última chamada a resolver() ou contarSolucoes()
+    const EstatisticasSolver& getEstatisticas() const { return stats; }
+
+private:
+    typedef TabuleiroN<B> T;
+    typedef typename T::Mascara Mascara;
+
+    struct Estado {
+        uint8_t celulas[T::NUM_CELULAS];
+        Mascara usado[T::NUM_UNIDADES];   // dígitos já presentes em cada unidade
+        int vazias;
+    };
+
+    std::deque<Estado> pilha;   // um estado por profundidade (referências estáveis)
+    EstatisticasSolver stats;
+    bool aleatorio;
+    Xoshiro256 rng;
+    int limite;
+    int encontradas;
+    long long limiteNos;
+    bool interrompido;
+    T* saida;
+
+    // Executa a busca completa a partir do tabuleiro; retorna o número de soluções
+    int executar(const T& tabuleiro, int limite, T* saida);
+    bool montar(const T& tabuleiro, Estado& e);
+    bool propagar(Estado& e);
+    bool buscar(int profundidade);
+};
+
+template <>
+bool SolverPropagacaoN<3>::resolver(TabuleiroN<3>& tabuleiro);
+
+template <>
+int SolverPropagacaoN<3>::contarSolucoes(const TabuleiroN<3>& tabuleiro, int limite);
+
+#endif // SOLVERN_H
@@ -0,0 +1,214 @@
+#include "SolverPortfolio.h"
+#include <memory>
+#include <mutex>
+#include <thread>
+#include "../ThreadPool/TokenParada.h"
+#include "../Trace/Rastreador.h"
+#include "SolverPropagacao.h"
+#include "SolverDLX.h"
+
+using namespace std;
+
+namespace {
+
+const long long LIMITE_TENTATIVA_PADRAO = 256;
+
+// Limite de nós do primeiro reinício aleatório (dobra a cada reinício)
+const long long LIMITE_PRIMEIRO_REINICIO = 64;
+
+void zerarEstatisticas(EstatisticasSolver& stats) {
+    stats.nosVisitados = 0;
+    stats.retrocessos = 0;
+    stats.celulasPropagadas = 0;
+    stats.tempoEmNs = chrono::nanoseconds(0);
+    stats.resolvido = false;
+}
+
+// Reinícios com ordem aleatória e limite crescente: uma ordem ruim custa no
+// máximo o limite da rodada. Quando o limite passa do tamanho da árvore a
+// rodada termina sem interrupção, então a estratégia também prova "sem solução".
+bool resolverComReinicios(Tabuleiro& tabuleiro, const TokenParada& token, uint64_t semente,
+                          EstatisticasSolver& stats, bool& interrompido) {
+    auto inicio = chrono::high_resolution_clock::now();
+    Xoshiro256 rng(semente);
+    SolverPropagacao solver;
+    solver.setTokenParada(token);
+    zerarEstatisticas(stats);
+
+    bool sucesso = false;
+    for (long long limite = LIMITE_PRIMEIRO_REINICIO; ; limite *= 2) {
+        solver.setAleatorio(true, rng());
+        solver.setLimiteNos(limite);
+        sucesso = solver.resolver(tabuleiro);
+
+        const EstatisticasSolver& rodada = solver.getEstatisticas();
+        stats.nosVisitados += rodada.nosVisitados;
+        stats.retrocessos += rodada.retrocessos;
+        stats.celulasPropagadas += rodada.celulasPropagadas;
+
+        // Rodadas curtas não chegam a consultar o token: confere entre elas
+        interrompido = solver.foiInterrompido();
+        if (!interrompido || token.paradaSolicitada()) {
+            break;
+        }
+    }
+
+    stats.resolvido = sucesso;
+    stats.tempoEmNs = chrono::duration_cast<chrono::nanoseconds>(
+        chrono::high_resolution_clock::now() - inicio);
+    return sucesso;
+}
+
+// Executa uma estratégia sobre o tabuleiro (alterado só se resolvido)
+bool executarEstrategia(EstrategiaSolver estrategia, Tabuleiro& tabuleiro, const TokenParada& token,
+                        uint64_t semente, EstatisticasSolver& stats, bool& interrompido) {
+    switch (estrategia) {
+        case EstrategiaSolver::MRV:
+        case EstrategiaSolver::DIGITO_RESTRITO: {
+            SolverPropagacao solver;
+            solver.setTokenParada(token);
+            if (estrategia == EstrategiaSolver::DIGITO_RESTRITO) {
+                solver.setRamificacao(RamificacaoPropagacao::DIGITO_RESTRITO);
+            }
+            bool sucesso = solver.resolver(tabuleiro);
+            stats = solver.getEstatisticas();
+            interrompido = solver.foiInterrompido();
+            return sucesso;
+        }
+        case EstrategiaSolver::REINICIOS_ALEATORIOS:
+            return resolverComReinicios(tabuleiro, token, semente, stats, interrompido);
+        case EstrategiaSolver::DLX: {
+            // ~40KB de nós pré-alocados: fica no heap, não na pilha da thread
+            unique_ptr<SolverDLX> solver(new SolverDLX());
+            solver->setTokenParada(token);
+            bool sucesso = solver->resolver(tabuleiro);
+            stats = solver->getEstatisticas();
+            interrompido = solver->foiInterrompido();
+            return sucesso;
+        }
+    }
+    interrompido = true;
+    return false;
+}
+
+} // namespace
+
+const char* nomeEstrategiaSolver(EstrategiaSolver estrategia) {
+    switch (estrategia) {
+        case EstrategiaSolver::MRV: return "MRV";
+        case EstrategiaSolver::DIGITO_RESTRITO: return "digito-restrito";
+        case EstrategiaSolver::REINICIOS_ALEATORIOS: return "reinicios-aleatorios";
+        case EstrategiaSolver::DLX: return "DLX";
+    }
+    return "?";
+}
+
+// Construtor
+SolverPortfolio::SolverPortfolio(uint64_t semente)
+    : limiteTentativaInicial(LIMITE_TENTATIVA_PADRAO), rng(semente) {
+    estrategias.push_back(EstrategiaSolver::MRV);
+    estrategias.push_back(EstrategiaSolver::DIGITO_RESTRITO);
+    estrategias.push_back(EstrategiaSolver::REINICIOS_ALEATORIOS);
+    estrategias.push_back(EstrategiaSolver::DLX);
+
+    resultado.resolvido = false;
+    resultado.corrida = false;
+    resultado.numEstrategias = 0;
+    resultado.vencedora = EstrategiaSolver::MRV;
+    zerarEstatisticas(resultado.statsVencedora);
+    resultado.tempoEmNs = chrono::nanoseconds(0);
+    zerarEstatisticas(stats);
+}
+
+void SolverPortfolio::setEstrategias(const vector<EstrategiaSolver>& estrategias) {
+    this->estrategias = estrategias;
+}
+
+void SolverPortfolio::setLimiteTentativaInicial(long long limite) {
+    limiteTentativaInicial = limite;
+}
+
+const ResultadoPortfolio& SolverPortfolio::getResultado() const {
+    return resultado;
+}
+
+const EstatisticasSolver& SolverPortfolio::getEstatisticas() const {
+    return stats;
+}
+
+bool SolverPortfolio::resolver(Tabuleiro& tabuleiro) {
+    RASTREAR("SolverPortfolio::resolver", "solver");
+    auto inicio = chrono::high_resolution_clock::now();
+
+    resultado.corrida = false;
+    resultado.numEstrategias = 0;
+    bool decidido = false;
+
+    // Tentativa inicial na thread atual: os tabuleiros fáceis terminam aqui
+    if (limiteTentativaInicial > 0 || estrategias.empty()) {
+        SolverPropagacao solver;
+        solver.setLimiteNos(limiteTentativaInicial);
+        resultado.resolvido = solver.resolver(tabuleiro);
+        resultado.vencedora = EstrategiaSolver::MRV;
+        resultado.statsVencedora = solver.getEstatisticas();
+        decidido = !solver.foiInterrompido();
+    }
+
+    if (!decidido) {
+        int n = static_cast<int>(estrategias.size());
+        resultado.corrida = true;
+        resultado.numEstrategias = n;
+
+        // Sementes sorteadas antes da largada: a thread só lê o que é dela
+        vector<uint64_t> sementes(n);
+        for (int k = 0; k < n; k++) {
+            sementes[k] = rng();
+        }
+
+        // Uma thread por estratégia, e não o pool: com menos trabalhadores que
+        // estratégias, as que ficassem na fila só largariam depois das primeiras
+        FonteParada fonte;
+        mutex mtxVencedora;
+        bool haVencedora = false;
+        Tabuleiro solucao = tabuleiro;
+        vector<thread> corredoras;
+        corredoras.reserve(n);
+
+        for (int k = 0; k < n; k++) {
+            corredoras.emplace_back([&, k] {
+                Tabuleiro copia = tabuleiro;
+                EstatisticasSolver statsEstrategia;
+                bool interrompido = false;
+                bool sucesso = executarEstrategia(estrategias[k], copia, fonte.token(), sementes[k],
+                                                  statsEstrategia, interrompido);
+                if (interrompido) {
+                    return;
+                }
+
+                lock_guard<mutex> trava(mtxVencedora);
+                if (!haVencedora) {
+                    haVencedora = true;
+                    fonte.solicitarParada();
+                    resultado.resolvido = sucesso;
+                    resultado.vencedora = estrategias[k];
+                    resultado.statsVencedora = statsEstrategia;
+                    solucao = copia;
+                }
+            });
+        }
+        for (thread& t : corredoras) {
+            t.join();
+        }
+
+        // A primeira a terminar nunca é interrompida, então sempre há vencedora
+        if (resultado.resolvido) {
+            tabuleiro = solucao;
+        }
+    }
+
+    resultado.tempoEmNs = chrono::duration_cast<chrono::nanoseconds>(
+        chrono::high_resolution_clock::now() - inicio);
+    stats = resultado.statsVencedora;
+    stats.tempoEmNs = resultado.tempoEmNs;
+    return resultado.resolvido;
+}
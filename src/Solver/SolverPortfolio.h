@@ -0,0 +1,68 @@
+#ifndef SOLVERPORTFOLIO_H
+#define SOLVERPORTFOLIO_H
+
+#include <chrono>
+#include <cstdint>
+#include <vector>
+#include "../Tabuleiro/Tabuleiro.h"
+#include "../Gerador/Xoshiro.h"
+#include "EstatisticasSolver.h"
+
+// Estratégias de busca que o portfólio pode colocar na corrida
+enum class EstrategiaSolver {
+    MRV,                    // SolverPropagacao ramificando na célula com menos candidatos
+    DIGITO_RESTRITO,        // SolverPropagacao ramificando no dígito com menos lugares
+    REINICIOS_ALEATORIOS,   // SolverPropagacao aleatório com limite de nós que dobra a cada reinício
+    DLX                     // SolverDLX (cobertura exata)
+};
+
+// Nome legível da estratégia (string estática, pode ir para o log)
+const char* nomeEstrategiaSolver(EstrategiaSolver estrategia);
+
+// Resultado da última chamada a SolverPortfolio::resolver()
+struct ResultadoPortfolio {
+    bool resolvido;
+    bool corrida;                        // false se a tentativa inicial já bastou
+    int numEstrategias;                  // estratégias que correram
+    EstrategiaSolver vencedora;
+    EstatisticasSolver statsVencedora;   // da busca vencedora (tempo só dela)
+    std::chrono::nanoseconds tempoEmNs;  // total, incluindo criar e juntar as threads
+};
+
+// Solver de portfólio: várias estratégias correm ao mesmo tempo, cada uma em
+// sua thread, sobre cópias do mesmo tabuleiro. A primeira que terminar sem
+// ser interrompida (achando a solução ou provando que não há) vence e pede
+// parada às outras pelo token compartilhado; as perdedoras desistem em até
+// 256 nós. Assim o tempo de um tabuleiro difícil para uma heurística fica
+// limitado pela heurística que se dá bem com ele.
+//
+// Antes da corrida, uma tentativa MRV com poucos nós resolve os tabuleiros
+// fáceis sem o custo de criar threads.
+class SolverPortfolio {
+public:
+    explicit SolverPortfolio(uint64_t semente);
+
+    // Estratégias da corrida (padrão: as quatro, na ordem do enum)
+    void setEstrategias(const std::vector<EstrategiaSolver>& estrategias);
+
+    // Nós da tentativa inicial antes da corrida (0 desativa; padrão 256)
+    void setLimiteTentativaInicial(long long limite);
+
+    // Resolve o tabuleiro no lugar. Se não houver solução retorna false e o
+    // tabuleiro não é alterado.
+    bool resolver(Tabuleiro& tabuleiro);
+
+    const ResultadoPortfolio& getResultado() const;
+
+    // Estatísticas da vencedora, com o tempo total da chamada
+    const EstatisticasSolver& getEstatisticas() const;
+
+private:
+    std::vector<EstrategiaSolver> estrategias;
+    long long limiteTentativaInicial;
+    Xoshiro256 rng;
+    ResultadoPortfolio resultado;
+    EstatisticasSolver stats;
+};
+
+#endif // SOLVERPORTFOLIO_H
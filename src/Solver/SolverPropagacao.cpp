@@ -0,0 +1,287 @@
+#include "SolverPropagacao.h"
+#include <cstring>
+#include "../Trace/Rastreador.h"
+
+using namespace std;
+
+namespace {
+
+const uint16_t TODOS_DIGITOS = 0x1FF;
+
+// Candidatos de uma célula: dígitos ausentes da sua linha, coluna e bloco
+inline uint16_t candidatosDe(const uint16_t* usado, int indice) {
+    const uint8_t* u = UNIDADES_DA_CELULA[indice];
+    return ~(usado[u[0]] | usado[u[1]] | usado[u[2]]) & TODOS_DIGITOS;
+}
+
+// Coloca o dígito representado por 'bit' na célula e o marca nas três unidades
+inline void atribuir(uint8_t* celulas, uint16_t* usado, int& vazias, int indice, uint16_t bit) {
+    celulas[indice] = static_cast<uint8_t>(__builtin_ctz(bit) + 1);
+    const uint8_t* u = UNIDADES_DA_CELULA[indice];
+    usado[u[0]] |= bit;
+    usado[u[1]] |= bit;
+    usado[u[2]] |= bit;
+    vazias--;
+}
+
+} // namespace
+
+// Construtor
+SolverPropagacao::SolverPropagacao()
+    : aleatorio(false), rng(0), ramificacao(RamificacaoPropagacao::CELULA_MRV), limiteNos(0),
+      interrompido(false) {
+    stats.nosVisitados = 0;
+    stats.retrocessos = 0;
+    stats.celulasPropagadas = 0;
+    stats.tempoEmNs = chrono::nanoseconds(0);
+    stats.resolvido = false;
+}
+
+void SolverPropagacao::setAleatorio(bool ativo, uint64_t semente) {
+    aleatorio = ativo;
+    rng.semear(semente);
+}
+
+void SolverPropagacao::setRamificacao(RamificacaoPropagacao ramificacao) {
+    this->ramificacao = ramificacao;
+}
+
+const EstatisticasSolver& SolverPropagacao::getEstatisticas() const {
+    return stats;
+}
+
+bool SolverPropagacao::resolver(Tabuleiro& tabuleiro) {
+    RASTREAR("SolverPropagacao::resolver", "solver");
+    auto inicio = chrono::high_resolution_clock::now();
+
+    stats.nosVisitados = 0;
+    stats.retrocessos = 0;
+    stats.celulasPropagadas = 0;
+    stats.resolvido = false;
+    interrompido = false;
+
+    // Montar o estado inicial, rejeitando tabuleiros que já têm conflitos
+    Estado estado;
+    memcpy(estado.celulas, tabuleiro.celulas, 81);
+    memset(estado.usado, 0, sizeof(estado.usado));
+    estado.vazias = 0;
+
+    bool consistente = true;
+    for (int i = 0; i < 81 && consistente; i++) {
+        int valor = estado.celulas[i];
+        if (valor == 0) {
+            estado.vazias++;
+            continue;
+        }
+        uint16_t bit = static_cast<uint16_t>(1u << (valor - 1));
+        for (int u : UNIDADES_DA_CELULA[i]) {
+            if (estado.usado[u] & bit) {
+                consistente = false;
+            }
+            estado.usado[u] |= bit;
+        }
+    }
+
+    if (consistente) {
+        stats.resolvido = buscar(estado, tabuleiro);
+    }
+
+    stats.tempoEmNs = chrono::duration_cast<chrono::nanoseconds>(
+        chrono::high_resolution_clock::now() - inicio);
+    return stats.resolvido;
+}
+
+// Aplica naked singles e hidden singles até não haver mais mudanças.
+// Retorna false se encontrar uma contradição.
+bool SolverPropagacao::propagar(Estado& e) {
+    bool mudou = true;
+    while (mudou && e.vazias > 0) {
+        mudou = false;
+
+        // Naked singles: célula com um único candidato
+        for (int i = 0; i < 81; i++) {
+            if (e.celulas[i] != 0) continue;
+            uint16_t cand = candidatosDe(e.usado, i);
+            if (cand == 0) {
+                return false;
+            }
+            if ((cand & (cand - 1)) == 0) {
+                atribuir(e.celulas, e.usado, e.vazias, i, cand);
+                stats.celulasPropagadas++;
+                mudou = true;
+            }
+        }
+
+        // Hidden singles: dígito com um único lugar possível na unidade
+        for (int u = 0; u < 27; u++) {
+            const uint8_t* unidade = CELULAS_DA_UNIDADE[u];
+            uint16_t umaVez = 0;
+            uint16_t duasVezes = 0;
+            for (int p = 0; p < 9; p++) {
+                int i = unidade[p];
+                if (e.celulas[i] != 0) continue;
+                uint16_t cand = candidatosDe(e.usado, i);
+                duasVezes |= umaVez & cand;
+                umaVez |= cand;
+            }
+
+            uint16_t faltando = ~e.usado[u] & TODOS_DIGITOS;
+            if ((umaVez & faltando) != faltando) {
+                return false; // algum dígito não cabe em lugar nenhum da unidade
+            }
+
+            uint16_t unicos = umaVez & ~duasVezes & faltando;
+            while (unicos) {
+                uint16_t bit = unicos & -unicos;
+                unicos &= unicos - 1;
+
+                bool colocado = false;
+                for (int p = 0; p < 9 && !colocado; p++) {
+                    int i = unidade[p];
+                    if (e.celulas[i] == 0 && (candidatosDe(e.usado, i) & bit)) {
+                        atribuir(e.celulas, e.usado, e.vazias, i, bit);
+                        colocado = true;
+                    }
+                }
+
+                if (colocado) {
+                    stats.celulasPropagadas++;
+                    mudou = true;
+                } else if (!(e.usado[u] & bit)) {
+                    return false; // o único lugar foi ocupado por outro hidden single
+                }
+            }
+        }
+    }
+    return true;
+}
+
+// Limite de nós atingido ou parada pedida (o token é consultado a cada 256 nós)
+bool SolverPropagacao::deveInterromper() {
+    if (!interrompido &&
+        ((limiteNos > 0 && stats.nosVisitados > limiteNos) ||
+         ((stats.nosVisitados & 255) == 0 && token.paradaSolicitada()))) {
+        interrompido = true;
+    }
+    return interrompido;
+}
+
+// Escolhe o par (unidade, dígito) com menos lugares possíveis. Depois da
+// propagação não há hidden singles, então todo dígito faltante tem 2 ou mais.
+int SolverPropagacao::escolherDigito(const Estado& e, uint16_t& bit, uint8_t lugares[LADO_TABULEIRO]) const {
+    int menor = LADO_TABULEIRO + 1;
+    int melhorUnidade = 0;
+    for (int u = 0; u < NUM_UNIDADES && menor > 2; u++) {
+        uint16_t faltando = ~e.usado[u] & TODOS_DIGITOS;
+        if (!faltando) continue;
+
+        int contagem[LADO_TABULEIRO] = {0};
+        for (int p = 0; p < LADO_TABULEIRO; p++) {
+            int i = CELULAS_DA_UNIDADE[u][p];
+            if (e.celulas[i] != 0) continue;
+            for (uint16_t c = candidatosDe(e.usado, i); c; c &= c - 1) {
+                contagem[__builtin_ctz(c)]++;
+            }
+        }
+        for (uint16_t f = faltando; f; f &= f - 1) {
+            int d = __builtin_ctz(f);
+            if (contagem[d] < menor) {
+                menor = contagem[d];
+                melhorUnidade = u;
+                bit = static_cast<uint16_t>(1u << d);
+            }
+        }
+    }
+
+    int n = 0;
+    for (int p = 0; p < LADO_TABULEIRO; p++) {
+        int i = CELULAS_DA_UNIDADE[melhorUnidade][p];
+        if (e.celulas[i] == 0 && (candidatosDe(e.usado, i) & bit)) {
+            lugares[n++] = static_cast<uint8_t>(i);
+        }
+    }
+    return n;
+}
+
+// Busca em profundidade com propagação a cada nó e ramificação MRV (ou por dígito)
+bool SolverPropagacao::buscar(Estado& e, Tabuleiro& saida) {
+    stats.nosVisitados++;
+
+    if (deveInterromper() || !propagar(e)) {
+        return false;
+    }
+
+    if (e.vazias == 0) {
+        memcpy(saida.celulas, e.celulas, 81);
+        return true;
+    }
+
+    if (ramificacao == RamificacaoPropagacao::DIGITO_RESTRITO) {
+        uint16_t bit = 0;
+        uint8_t lugares[LADO_TABULEIRO];
+        int numLugares = escolherDigito(e, bit, lugares);
+        if (aleatorio) {
+            rng.embaralhar(lugares, numLugares);
+        }
+        for (int k = 0; k < numLugares; k++) {
+            Estado filho = e;
+            atribuir(filho.celulas, filho.usado, filho.vazias, lugares[k], bit);
+            if (buscar(filho, saida)) {
+                return true;
+            }
+            if (interrompido) {
+                return false;
+            }
+            stats.retrocessos++;
+        }
+        return false;
+    }
+
+    // Escolher a célula vazia com menos candidatos
+    int melhor = -1;
+    int menor = 10;
+    uint16_t candMelhor = 0;
+    for (int i = 0; i < 81 && menor > 2; i++) {
+        if (e.celulas[i] != 0) continue;
+        uint16_t cand = candidatosDe(e.usado, i);
+        int n = __builtin_popcount(cand);
+        if (n < menor) {
+            menor = n;
+            melhor = i;
+            candMelhor = cand;
+        }
+    }
+
+    uint16_t digitos[9];
+    int numDigitos = 0;
+    for (uint16_t c = candMelhor; c; c &= c - 1) {
+        digitos[numDigitos++] = c & -c;
+    }
+    if (aleatorio) {
+        rng.embaralhar(digitos, numDigitos);
+    }
+
+    for (int k = 0; k < numDigitos; k++) {
+        Estado filho = e;
+        atribuir(filho.celulas, filho.usado, filho.vazias, melhor, digitos[k]);
+        if (buscar(filho, saida)) {
+            return true;
+        }
+        if (interrompido) {
+            return false;
+        }
+        stats.retrocessos++;
+    }
+
+    return false;
+}
+
+// Resolve um tabuleiro com o solver por propagação (sem aleatoriedade)
+bool resolverComPropagacao(Tabuleiro& tabuleiro, EstatisticasSolver* stats) {
+    SolverPropagacao solver;
+    bool resolvido = solver.resolver(tabuleiro);
+    if (stats) {
+        *stats = solver.getEstatisticas();
+    }
+    return resolvido;
+}
@@ -0,0 +1,73 @@
+#ifndef SOLVERPROPAGACAO_H
+#define SOLVERPROPAGACAO_H
+
+#include <cstdint>
+#include "../Tabuleiro/Tabuleiro.h"
+#include "../Gerador/Xoshiro.h"
+#include "../ThreadPool/TokenParada.h"
+#include "EstatisticasSolver.h"
+
+// Onde o solver por propagação ramifica quando a propagação estabiliza
+enum class RamificacaoPropagacao {
+    CELULA_MRV,        // célula vazia com menos candidatos, tentando cada dígito
+    DIGITO_RESTRITO    // par (unidade, dígito) com menos lugares, tentando cada lugar
+};
+
+// Solver por propagação de restrições.
+// Cada unidade guarda a máscara de 9 bits dos dígitos já usados; os candidatos de
+// uma célula são o complemento das máscaras de sua linha, coluna e bloco.
+// A cada nó aplica naked singles e hidden singles até estabilizar e então
+// ramifica na célula com menos candidatos (MRV) ou, opcionalmente, no dígito
+// com menos lugares possíveis em alguma unidade.
+class SolverPropagacao {
+public:
+    SolverPropagacao();
+
+    // Ordem aleatória dos dígitos em cada ramificação (usado para gerar tabuleiros)
+    void setAleatorio(bool aleatorio, uint64_t semente);
+
+    // Estratégia de ramificação (CELULA_MRV por padrão)
+    void setRamificacao(RamificacaoPropagacao ramificacao);
+
+    // Limite de nós por chamada (0 = sem limite) e token de parada, consultado
+    // a cada 256 nós. Ao atingir um dos dois a busca para, resolver() retorna
+    // false sem alterar o tabuleiro e foiInterrompido() retorna true.
+    void setLimiteNos(long long limite) { limiteNos = limite; }
+    void setTokenParada(const TokenParada& token) { this->token = token; }
+    bool foiInterrompido() const { return interrompido; }
+
+    // Resolve o tabuleiro no lugar. Se não houver solução retorna false e o
+    // tabuleiro não é alterado.
+    bool resolver(Tabuleiro& tabuleiro);
+
+    // Estatísticas da última chamada a resolver()
+    const EstatisticasSolver& getEstatisticas() const;
+
+private:
+    // Estado de um nó da busca: copiado a cada ramificação (~140 bytes)
+    struct Estado {
+        uint8_t celulas[81];
+        uint16_t usado[27];   // dígitos já presentes em cada unidade
+        int vazias;
+    };
+
+    EstatisticasSolver stats;
+    bool aleatorio;
+    Xoshiro256 rng;
+    RamificacaoPropagacao ramificacao;
+    long long limiteNos;
+    TokenParada token;
+    bool interrompido;
+
+    bool buscar(Estado& estado, Tabuleiro& saida);
+    bool propagar(Estado& estado);
+    bool deveInterromper();
+
+    // Escolhe o par (unidade, dígito) com menos lugares; retorna quantos e os preenche
+    int escolherDigito(const Estado& estado, uint16_t& bit, uint8_t lugares[LADO_TABULEIRO]) const;
+};
+
+// Resolve um tabuleiro com o solver por propagação (sem aleatoriedade)
+bool resolverComPropagacao(Tabuleiro& tabuleiro, EstatisticasSolver* stats = nullptr);
+
+#endif // SOLVERPROPAGACAO_H
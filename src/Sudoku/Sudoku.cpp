@@ -8,426 +8,755 @@
 #include <condition_variable>
 #include <future>
 #include <chrono>
+#include "../Trace/Rastreador.h"
 
 using namespace std;
 
-// Método para verificar se um valor é válido em uma posição específica
-bool Sudoku::isValidValue(int row, int col, int value) {
-    // Verificar linha
-    for (int i = 0; i < 9; i++) {
-        if (matriz[row][i] == value && i != col) {
-            return false;
-        }
-    }
+namespace {
 
-    // Verificar coluna
-    for (int i = 0; i < 9; i++) {
-        if (matriz[i][col] == value && i != row) {
+// Varre as células uma a uma, conferindo cada valor contra a linha, a coluna
+// e o bloco. Desiste (retornando false) se o token pedir parada.
+bool varrerCelulas(const Tabuleiro& matriz, const TokenParada& token,
+                   int& celulasVerificadas, int& conflitosEncontrados) {
+    bool valido = true;
+    for (int row = 0; row < LADO_TABULEIRO; row++) {
+        if (token.paradaSolicitada()) {
             return false;
         }
-    }
-
-    // Verificar bloco 3x3
-    int startRow = row - row % 3;
-    int startCol = col - col % 3;
-    for (int i = 0; i < 3; i++) {
-        for (int j = 0; j < 3; j++) {
-            if (matriz[i + startRow][j + startCol] == value && 
-                (i + startRow != row || j + startCol != col)) {
-                return false;
+        for (int col = 0; col < LADO_TABULEIRO; col++) {
+            int value = matriz.get(row, col);
+            if (value != 0) {
+                celulasVerificadas++;
+                // podeColocar ignora a própria célula, não é preciso removê-la
+                if (!matriz.podeColocar(row, col, value)) {
+                    valido = false;
+                    conflitosEncontrados++;
+                }
+            }
+            else{
+                // Célula vazia ⇒ estado incompleto
+                valido = false;
+                LOG_INFO("[Thread de Validação] INCOMPLETO (célula vazia em {},{})", row+1, col+1);
             }
         }
     }
-
-    return true;
+    return valido;
 }
 
+} // namespace
+
 // Função que será executada pela thread de validação
 void Sudoku::validationFunction() {
+    Rastreador& rastreador = Rastreador::global();
+    if (rastreador.ativo()) {
+        rastreador.nomearThread("thread de validação");
+    }
+    RASTREAR("validationFunction", "validacao");
+
+    // A thread é nova a cada validação: o grupo de contadores é aberto antes de medir
+    GrupoContadores* grupo = medirContadores ? &GrupoContadores::daThread() : nullptr;
+    if (grupo) grupo->iniciar();
+
     auto inicioMs  = std::chrono::high_resolution_clock::now();
     auto inicioNs  = inicioMs;
     std::clock_t inicioCpu = std::clock();
     
-    lock_guard<mutex> lock(mtx);
-    isThreadValid = true;
-    
+    // A varredura usa variáveis locais: mtx só é tomado para publicar o resultado
     int celulasVerificadas = 0;
     int conflitosEncontrados = 0;
     
     // Verificar se a matriz é válida
-    for (int row = 0; row < 9; row++) {
-        for (int col = 0; col < 9; col++) {
-            int value = matriz[row][col];
-            if (value != 0) {
-                celulasVerificadas++;
-                // Temporariamente remover o valor para verificar
-                matriz[row][col] = 0;
-                if (!isValidValue(row, col, value)) {
-                    isThreadValid = false;
-                    conflitosEncontrados++;
-                }
-                // Restaurar o valor
-                matriz[row][col] = value;
-            }
-            else{
-                // Célula vazia ⇒ estado incompleto
-                isThreadValid = false;
-                cout << "[Thread de Validação] INCOMPLETO (célula vazia em "
-                     << row+1 << "," << col+1 << ")" << endl;
-            }
-        }
-    }
+    bool valido = varrerCelulas(matriz, TokenParada(), celulasVerificadas, conflitosEncontrados);
     
     auto fimMs = std::chrono::high_resolution_clock::now();
     auto fimNs = fimMs;
     std::clock_t fimCpu = std::clock();
+    ContadoresHW contadores;
+    if (grupo) contadores = grupo->parar();
     
     auto duracaoMs = chrono::duration_cast<chrono::milliseconds>(fimMs - inicioMs);
     auto duracaoNs = chrono::duration_cast<chrono::nanoseconds>(fimNs - inicioNs);
     
-    // Armazenar estatísticas
-    ultimasStats.tempoExecucao = duracaoMs;
-    ultimasStats.tempoEmNs = duracaoNs;
-    ultimasStats.cpuTicks = fimCpu - inicioCpu;
-    ultimasStats.numCelulasVerificadas = celulasVerificadas;
-    ultimasStats.numConflitosEncontrados = conflitosEncontrados;
-    ultimasStats.numThreadsUsadas = 1;
+    // Armazenar resultado e estatísticas (o log sai depois de soltar mtx)
+    {
+        lock_guard<mutex> lock(mtx);
+        registrarContadoresThreadUnica(grupo != nullptr, contadores);
+        isThreadValid = valido;
+        ultimasStats.tempoExecucao = duracaoMs;
+        ultimasStats.tempoEmNs = duracaoNs;
+        ultimasStats.cpuTicks = fimCpu - inicioCpu;
+        ultimasStats.numCelulasVerificadas = celulasVerificadas;
+        ultimasStats.numConflitosEncontrados = conflitosEncontrados;
+        ultimasStats.numThreadsUsadas = 1;
+        ultimoRelatorio = RelatorioConflitos();
+        // Modo de thread única não passa pelo pool: não há espera em fila
+        ultimasStats.numTarefas = 1;
+        ultimasStats.tempoEmFila = chrono::nanoseconds(0);
+        ultimasStats.tempoTarefas = duracaoNs;
+    }
     
     validacaoConcluida.store(true);
     cv.notify_all();
     
-    cout << "\n[Thread de Validação] Concluída em " << duracaoMs.count() 
-         << "ms, " << duracaoNs.count() << "ns, verificadas " << celulasVerificadas << " células, encontrados " 
-         << conflitosEncontrados << " conflitos." << endl;
+    LOG_INFO("\n[Thread de Validação] Concluída em {}ms, {}ns, verificadas {} células, encontrados {} conflitos.",
+             duracaoMs.count(), duracaoNs.count(), celulasVerificadas, conflitosEncontrados);
 }
 
-// Função para validar linhas
-bool Sudoku::validarLinhas(int startRow, int endRow) {
-    auto inicio = chrono::high_resolution_clock::now();
-    
-    bool valido = true;
-    int celulasVerificadas = 0;
-    int conflitosEncontrados = 0;
-    
-    for (int row = startRow; row < endRow; row++) {
-        vector<bool> numeros(10, false); // Índices 1-9 para valores
-        for (int col = 0; col < 9; col++) {
-            int valor = matriz[row][col];
-            celulasVerificadas++;
-            if (valor != 0) {
-                if (numeros[valor]) {
-                    valido = false;
-                    conflitosEncontrados++;
-                }
-                numeros[valor] = true;
-            }
-            else {
-                lock_guard<mutex> lock(mtx);
-                cout << "[Thread " << this_thread::get_id()
-                     << "] Linhas " << startRow+1 << "-" << endRow
-                     << ": INCOMPLETO (célula vazia em " 
-                     << row+1 << "," << col+1 << ")" << endl;
-                return false;  // Sinaliza "incompleto" como falso
-            }
-        }
-    }
-    
-    auto fim = chrono::high_resolution_clock::now();
-    auto duracao = chrono::duration_cast<chrono::milliseconds>(fim - inicio);
-    
-    lock_guard<mutex> lock(mtx);
-    cout << "[Thread " << this_thread::get_id() << "] Validação de linhas " 
-         << startRow+1 << "-" << endRow << " concluída em " << duracao.count() 
-         << "ms, " << (valido ? "válido" : "inválido") << ", conflitos: " 
-         << conflitosEncontrados << endl;
-    
-    return valido;
-}
+// Preenche as estatísticas e o relatório comuns aos dois modos paralelos
+void Sudoku::registrarStatsParalelas(const ThreadPool::Lote& lote,
+                                     chrono::high_resolution_clock::time_point inicio,
+                                     std::clock_t inicioCpu, const RelatorioConflitos& relatorio) {
+    auto fimMs = chrono::high_resolution_clock::now();
+    auto fimNs = fimMs;
+    std::clock_t fimCpu = std::clock();
 
-// Função para validar colunas
-bool Sudoku::validarColunas(int startCol, int endCol) { 
-    auto inicio = chrono::high_resolution_clock::now();
-    
-    bool valido = true;
-    int celulasVerificadas = 0;
-    int conflitosEncontrados = 0;
-    
-    for (int col = startCol; col < endCol; col++) {
-        vector<bool> numeros(10, false); // Índices 1-9 para valores
-        for (int row = 0; row < 9; row++) {
-            int valor = matriz[row][col];
-            celulasVerificadas++;
-            if (valor != 0) {
-                if (numeros[valor]) {
-                    valido = false;
-                    conflitosEncontrados++;
-                }
-                numeros[valor] = true;
-            }
-            else {
-                lock_guard<mutex> lock(mtx);
-                cout << "[Thread " << this_thread::get_id()
-                     << "] Colunas " << startCol+1 << "-" << endCol
-                     << ": INCOMPLETO (célula vazia em "
-                     << row+1 << "," << col+1 << ")" << endl;
-                return false; //Também sinaliza incompleto como falso
-            }
-        }
-    }
-    
-    auto fim = chrono::high_resolution_clock::now();
-    auto duracao = chrono::duration_cast<chrono::milliseconds>(fim - inicio);
-    
-    lock_guard<mutex> lock(mtx);
-    cout << "[Thread " << this_thread::get_id() << "] Validação de colunas " 
-         << startCol+1 << "-" << endCol << " concluída em " << duracao.count() 
-         << "ms, " << (valido ? "válido" : "inválido") << ", conflitos: " 
-         << conflitosEncontrados << endl;
-    
-    return valido;
+    auto duracaoMs = chrono::duration_cast<chrono::milliseconds>(fimMs - inicio);
+    auto duracaoNs = chrono::duration_cast<chrono::nanoseconds>(fimNs - inicio);
+
+    ultimasStats.tempoExecucao         = duracaoMs;
+    ultimasStats.tempoEmNs             = duracaoNs;
+    ultimasStats.cpuTicks              = fimCpu - inicioCpu;
+    ultimasStats.numTarefas            = lote.numTarefas();
+    // Nunca usamos mais threads do que o pool possui
+    ultimasStats.numThreadsUsadas      = std::min<int>(lote.numTarefas(), pool->numThreads());
+    // Cada célula é validada 3×, uma para as linhas, uma para colunas e outra
+    // para blocos; com PARAR_NO_PRIMEIRO, só as unidades vistas antes da parada
+    ultimasStats.numCelulasVerificadas = relatorio.numUnidadesVerificadas() * LADO_TABULEIRO;
+    ultimasStats.numConflitosEncontrados = relatorio.numCelulasEmConflito();
+    ultimasStats.tempoEmFila           = lote.tempoEmFila();
+    ultimasStats.tempoTarefas          = lote.tempoExecutando();
+    ultimasStats.contadoresMedidos     = medirContadores;
+    ultimasStats.contadores            = lote.contadores();
+    ultimasStats.contadoresPorThread   = lote.contadoresPorThread();
+    ultimoRelatorio = relatorio;
 }
 
-// Função para validar blocos 3x3
-bool Sudoku::validarBlocos(int startBlock, int endBlock) {
-    auto inicio = chrono::high_resolution_clock::now();
-    
-    bool valido = true;
-    int celulasVerificadas = 0;
-    int conflitosEncontrados = 0;
-    
-    for (int block = startBlock; block < endBlock; block++) {
-        int startRow = (block / 3) * 3;
-        int startCol = (block % 3) * 3;
-        
-        vector<bool> numeros(10, false); // Índices 1-9 para valores
-        for (int i = 0; i < 3; i++) {
-            for (int j = 0; j < 3; j++) {
-                int valor = matriz[startRow + i][startCol + j];
-                celulasVerificadas++;
-                if (valor != 0) {
-                    if (numeros[valor]) {
-                        valido = false;
-                        conflitosEncontrados++;
-                    }
-                    numeros[valor] = true;
-                }
-                else{
-                    lock_guard<mutex> lock(mtx);
-                    cout << "[Thread " << this_thread::get_id()
-                         << "] Bloco " << block+1
-                         << ": INCOMPLETO (célula vazia em "
-                         << (startRow + i +1) << ","
-                         << (startCol + j +1) << ")" << endl;
-                    return false;
-                }
-            }
-        }
+// Preenche os contadores de hardware dos modos que rodam em uma única thread
+void Sudoku::registrarContadoresThreadUnica(bool medidos, const ContadoresHW& contadores) {
+    ultimasStats.contadoresMedidos = medidos;
+    ultimasStats.contadores = contadores;
+    ultimasStats.contadoresPorThread.clear();
+    if (medidos) {
+        ContadoresThread unica;
+        unica.tarefas = 1;
+        unica.contadores = contadores;
+        ultimasStats.contadoresPorThread.push_back(unica);
     }
-    
-    auto fim = chrono::high_resolution_clock::now();
-    auto duracao = chrono::duration_cast<chrono::milliseconds>(fim - inicio);
-    
-    lock_guard<mutex> lock(mtx);
-    cout << "[Thread " << this_thread::get_id() << "] Validação de blocos " 
-         << startBlock+1 << "-" << endBlock << " concluída em " << duracao.count() 
-         << "ms, " << (valido ? "válido" : "inválido") << ", conflitos: " 
-         << conflitosEncontrados << endl;
-    
-    return valido;
 }
 
-// Método para iniciar validação paralela com 11 threads
+// Método para iniciar validação paralela com 2 + N tarefas no pool
+// (linhas, colunas e uma tarefa por bloco: 11 no 9x9)
 void Sudoku::iniciarValidacaoParalela() {
-    // 1) Finaliza eventuais threads antigas
-    for (auto& t : threadsValidacao) {
-        if (t.joinable()) t.join();
-    }
-    threadsValidacao.clear();
+    RASTREAR("iniciarValidacaoParalela", "validacao");
+
+    // 1) Descarta futuros de validações antigas
     futurosValidacao.clear();
 
     // 2) Marca início da medição
     auto inicioMs = chrono::high_resolution_clock::now();
-    auto inicioNs = inicioMs;
     std::clock_t inicioCpu = std::clock();
     
-    cout << "\n[Sistema] Iniciando validação paralela com 11 threads..." << endl;
+    LOG_INFO("\n[Sistema] Iniciando validação paralela com {} tarefas ({} threads no pool)...",
+             2 + LADO_TABULEIRO, pool->numThreads());
 
     // 3) Flags de controle
     validacaoConcluida.store(false);
-    isThreadValid = true;
+    bool valido = true;
 
-    // 4) Thread única para colunas (0–9)
-    {
-        packaged_task<bool()> task(
-            bind(&Sudoku::validarColunas, this, 0, 9)
-        );
-        futurosValidacao.push_back(task.get_future());
-        threadsValidacao.emplace_back(std::move(task));
-    }
+    ThreadPool::Lote lote(*pool);
+    lote.setMedirContadores(medirContadores);
 
-    // 5) Thread única para linhas (0–9)
-    {
-        packaged_task<bool()> task(
-            bind(&Sudoku::validarLinhas, this, 0, 9)
-        );
-        futurosValidacao.push_back(task.get_future());
-        threadsValidacao.emplace_back(std::move(task));
-    }
+    // As tarefas só leem o tabuleiro, que não muda até o lote terminar,
+    // e juntam seus achados no contexto sem trava
+    const Tabuleiro* t = &matriz;
+    ContextoValidacao contexto(politicaValidacao);
+    ContextoValidacao* c = &contexto;
 
-    // 6) Nove threads, uma para cada bloco 3×3
-    for (int block = 0; block < 9; block++) {
-        packaged_task<bool()> task(
-            bind(&Sudoku::validarBlocos, this, block, block + 1)
-        );
-        futurosValidacao.push_back(task.get_future());
-        threadsValidacao.emplace_back(std::move(task));
+    // 4) Tarefa única para todas as colunas
+    futurosValidacao.push_back(lote.enviar([t, c]() { return validarColunas(*t, 0, LADO_TABULEIRO, c); }));
+
+    // 5) Tarefa única para todas as linhas
+    futurosValidacao.push_back(lote.enviar([t, c]() { return validarLinhas(*t, 0, LADO_TABULEIRO, c); }));
+
+    // 6) Uma tarefa para cada bloco
+    for (int block = 0; block < LADO_TABULEIRO; block++) {
+        futurosValidacao.push_back(lote.enviar([t, c, block]() { return validarBlocos(*t, block, block + 1, c); }));
     }
 
     // 7) Coleta resultados
     for (auto& fut : futurosValidacao) {
+        RASTREAR("future::get", "validacao");
         if (!fut.get()) {
-            isThreadValid = false;
+            valido = false;
         }
     }
 
-    // 8) Garante join em todas as threads
-    for (auto& t : threadsValidacao) {
-        if (t.joinable()) t.join();
+    // 8) Barreira: garante que todas as tarefas do lote terminaram
+    {
+        RASTREAR("aguardar lote", "validacao");
+        lote.aguardar();
     }
 
-    // 9) Estatísticas e relatório
-    auto fimMs = chrono::high_resolution_clock::now();
-    auto fimNs = fimMs;
-    std::clock_t fimCpu = std::clock();
-    
-    auto duracaoMs = chrono::duration_cast<chrono::milliseconds>(fimMs - inicioMs);
-    auto duracaoNs = chrono::duration_cast<chrono::nanoseconds>(fimNs - inicioNs);
-    
-    ultimasStats.tempoExecucao         = duracaoMs;
-    ultimasStats.tempoEmNs             = duracaoNs;
-    ultimasStats.cpuTicks              = fimCpu - inicioCpu;
-    // 1 thread columnas + 1 thread linhas + 9 threads blocos
-    ultimasStats.numThreadsUsadas     = 11;
-    // 81 células validadas 3×, uma para as linhas, uma para colunas e outra para blocos
-    ultimasStats.numCelulasVerificadas = 9 * 9 * 3;
+    // 9) Estatísticas e relatório (sob mtx: uma validação assíncrona pode estar
+    //    publicando). O log usa cópias tiradas ainda sob a trava.
+    long long ms, ns;
+    int celulas, conflitos;
+    {
+        lock_guard<mutex> lock(mtx);
+        isThreadValid = valido;
+        registrarStatsParalelas(lote, inicioMs, inicioCpu, contexto.relatorio());
+        ms = ultimasStats.tempoExecucao.count();
+        ns = ultimasStats.tempoEmNs.count();
+        celulas = ultimasStats.numCelulasVerificadas;
+        conflitos = ultimasStats.numConflitosEncontrados;
+    }
 
     validacaoConcluida.store(true);
 
-    cout << "[Sistema] Validação paralela concluída em "
-         << duracaoMs.count() << "ms, " << duracaoNs.count() << "ns, verificadas "
-        << ultimasStats.numCelulasVerificadas << " células, encontrados " 
-         << ultimasStats.numConflitosEncontrados << " conflitos." << endl;
-    cout << "[Sistema] Resultado: O tabuleiro é "
-         << (isThreadValid ? "válido" : "inválido") << endl;
+    LOG_INFO("[Sistema] Validação paralela concluída em {}ms, {}ns, verificadas {} células, encontrados {} conflitos.",
+             ms, ns, celulas, conflitos);
+    LOG_INFO("[Sistema] Resultado: O tabuleiro é {}", valido ? "válido" : "inválido");
+    LogAssincrono::global().descarregar();
 }
 
-// Método para iniciar validação paralela detalhada com 27 threads
+// Método para iniciar validação paralela detalhada com uma tarefa por unidade (27 no 9x9)
 void Sudoku::iniciarValidacaoParalelaDetalhada() {
-    // 1) Finaliza eventuais threads antigas
-    for (auto& t : threadsValidacao) {
-        if (t.joinable()) t.join();
-    }
-    threadsValidacao.clear();
+    RASTREAR("iniciarValidacaoParalelaDetalhada", "validacao");
+
+    // 1) Descarta futuros de validações antigas
     futurosValidacao.clear();
 
     // 2) Marca início da medição
     auto inicioMs = chrono::high_resolution_clock::now();
-    auto inicioNs = inicioMs;
     std::clock_t inicioCpu = std::clock();
     
-    cout << "\n[Sistema] Iniciando validação paralela detalhada com 27 threads..." << endl;
+    LOG_INFO("\n[Sistema] Iniciando validação paralela detalhada com {} tarefas ({} threads no pool)...",
+             NUM_UNIDADES, pool->numThreads());
 
     // 3) Flags de controle
     validacaoConcluida.store(false);
-    isThreadValid = true;
+    bool valido = true;
+
+    ThreadPool::Lote lote(*pool);
+    lote.setMedirContadores(medirContadores);
 
-    // 4) Nove threads, uma para cada LINHA
-    for (int row = 0; row < 9; row++) {
-        packaged_task<bool()> task(
-            bind(&Sudoku::validarLinhas, this, row, row + 1)
-        );
-        futurosValidacao.push_back(task.get_future());
-        threadsValidacao.emplace_back(std::move(task));
+    // As tarefas só leem o tabuleiro, que não muda até o lote terminar,
+    // e juntam seus achados no contexto sem trava
+    const Tabuleiro* t = &matriz;
+    ContextoValidacao contexto(politicaValidacao);
+    ContextoValidacao* c = &contexto;
+
+    // 4) Uma tarefa para cada LINHA
+    for (int row = 0; row < LADO_TABULEIRO; row++) {
+        futurosValidacao.push_back(lote.enviar([t, c, row]() { return validarLinhas(*t, row, row + 1, c); }));
     }
 
-    // 5) Nove threads, uma para cada COLUNA
-    for (int col = 0; col < 9; col++) {
-        packaged_task<bool()> task(
-            bind(&Sudoku::validarColunas, this, col, col + 1)
-        );
-        futurosValidacao.push_back(task.get_future());
-        threadsValidacao.emplace_back(std::move(task));
+    // 5) Uma tarefa para cada COLUNA
+    for (int col = 0; col < LADO_TABULEIRO; col++) {
+        futurosValidacao.push_back(lote.enviar([t, c, col]() { return validarColunas(*t, col, col + 1, c); }));
     }
 
-    // 6) Nove threads, uma para cada BLOCO 3×3
-    for (int block = 0; block < 9; block++) {
-        packaged_task<bool()> task(
-            bind(&Sudoku::validarBlocos, this, block, block + 1)
-        );
-        futurosValidacao.push_back(task.get_future());
-        threadsValidacao.emplace_back(std::move(task));
+    // 6) Uma tarefa para cada BLOCO
+    for (int block = 0; block < LADO_TABULEIRO; block++) {
+        futurosValidacao.push_back(lote.enviar([t, c, block]() { return validarBlocos(*t, block, block + 1, c); }));
     }
 
-    // 7) Coleta resultados de todas as 27 threads
+    // 7) Coleta resultados de todas as tarefas
     for (auto& fut : futurosValidacao) {
+        RASTREAR("future::get", "validacao");
         if (!fut.get()) {
-            isThreadValid = false;
+            valido = false;
         }
     }
 
-    // 8) Garante join em todas as threads
-    for (auto& t : threadsValidacao) {
-        if (t.joinable()) t.join();
+    // 8) Barreira: garante que todas as tarefas do lote terminaram
+    {
+        RASTREAR("aguardar lote", "validacao");
+        lote.aguardar();
+    }
+
+    // 9) Estatísticas e relatório (sob mtx: uma validação assíncrona pode estar
+    //    publicando). O log usa cópias tiradas ainda sob a trava.
+    long long ms, ns;
+    int celulas, conflitos;
+    {
+        lock_guard<mutex> lock(mtx);
+        isThreadValid = valido;
+        registrarStatsParalelas(lote, inicioMs, inicioCpu, contexto.relatorio());
+        ms = ultimasStats.tempoExecucao.count();
+        ns = ultimasStats.tempoEmNs.count();
+        celulas = ultimasStats.numCelulasVerificadas;
+        conflitos = ultimasStats.numConflitosEncontrados;
     }
 
-    // 9) Estatísticas e relatório
+    validacaoConcluida.store(true);
+
+    LOG_INFO("[Sistema] Validação paralela detalhada concluída em {}ms, {}ns, verificadas {} células, encontrados {} conflitos.",
+             ms, ns, celulas, conflitos);
+    LOG_INFO("[Sistema] Resultado: O tabuleiro é {}", valido ? "válido" : "inválido");
+    LogAssincrono::global().descarregar();
+}
+
+// Método para validar com máscaras de bits (kernel SIMD escolhido em tempo de execução)
+void Sudoku::iniciarValidacaoMascara() {
+    RASTREAR("iniciarValidacaoMascara", "validacao");
+    GrupoContadores* grupo = medirContadores ? &GrupoContadores::daThread() : nullptr;
+    if (grupo) grupo->iniciar();
+
+    auto inicioMs = chrono::high_resolution_clock::now();
+    std::clock_t inicioCpu = std::clock();
+
+    validacaoConcluida.store(false);
+
+    // O tabuleiro já está em 81 bytes contíguos, formato esperado pelo kernel
+    KernelMascara kernel = kernelMascaraAtivo();
+    ResultadoMascara resultado = validarComMascaras(matriz.celulas, kernel);
+
     auto fimMs = chrono::high_resolution_clock::now();
-    auto fimNs = fimMs;
     std::clock_t fimCpu = std::clock();
-    
+    ContadoresHW contadores;
+    if (grupo) contadores = grupo->parar();
+
     auto duracaoMs = chrono::duration_cast<chrono::milliseconds>(fimMs - inicioMs);
-    auto duracaoNs = chrono::duration_cast<chrono::nanoseconds>(fimNs - inicioNs);
-    
-    ultimasStats.tempoExecucao         = duracaoMs;
-    ultimasStats.tempoEmNs             = duracaoNs;
-    ultimasStats.cpuTicks              = fimCpu - inicioCpu;
-    // 9 thread colunas + 9 thread linhas + 9 threads blocos 
-    ultimasStats.numThreadsUsadas      = 27;
-    // 81 células validadas 3×, nove para as linhas, nove para colunas e nove para blocos
-    ultimasStats.numCelulasVerificadas = 9 * 9 * 3;
+    auto duracaoNs = chrono::duration_cast<chrono::nanoseconds>(fimMs - inicioMs);
+
+    // Só as escritas ficam sob mtx: o log e a descarga (E/S) vêm depois
+    {
+        lock_guard<mutex> lock(mtx);
+        isThreadValid = resultado.resultado == ResultadoValidacao::VALIDO;
+        registrarContadoresThreadUnica(grupo != nullptr, contadores);
+        ultimasStats.tempoExecucao           = duracaoMs;
+        ultimasStats.tempoEmNs               = duracaoNs;
+        ultimasStats.cpuTicks                = fimCpu - inicioCpu;
+        // As 27 unidades são verificadas juntas: cada célula é lida uma vez por unidade
+        ultimasStats.numCelulasVerificadas   = NUM_CELULAS * 3;
+        ultimasStats.numConflitosEncontrados = resultado.numConflitos;
+        ultimasStats.numThreadsUsadas        = 1;
+        ultimoRelatorio = RelatorioConflitos();
+        ultimasStats.numTarefas              = 1;
+        ultimasStats.tempoEmFila             = chrono::nanoseconds(0);
+        ultimasStats.tempoTarefas            = duracaoNs;
+    }
 
     validacaoConcluida.store(true);
 
-    cout << "[Sistema] Validação paralela detalhada concluída em "
-         << duracaoMs.count() << "ms, " << duracaoNs.count() << "ns, verificadas "
-        << ultimasStats.numCelulasVerificadas << " células, encontrados " 
-         << ultimasStats.numConflitosEncontrados << " conflitos." << endl;
-    cout << "[Sistema] Resultado: O tabuleiro é "
-         << (isThreadValid ? "válido" : "inválido") << endl;
+    LOG_INFO("\n[Sistema] Validação por máscaras (kernel {}) concluída em {}ms, {}ns, {} células vazias, encontrados {} conflitos.",
+             nomeKernelMascara(kernel), duracaoMs.count(), duracaoNs.count(),
+             resultado.numVazias, resultado.numConflitos);
+    LOG_INFO("[Sistema] Resultado: O tabuleiro é {}",
+             resultado.resultado == ResultadoValidacao::VALIDO ? "válido" :
+             resultado.resultado == ResultadoValidacao::INVALIDO ? "inválido" : "incompleto");
+    LogAssincrono::global().descarregar();
+}
+
+// ---------------------------------------------------------------------------
+// Validação assíncrona
+
+namespace {
+
+// O que cada tarefa de uma validação assíncrona verifica
+enum TipoTarefaAssincrona { TAREFA_CELULAS, TAREFA_LINHAS, TAREFA_COLUNAS, TAREFA_BLOCOS, TAREFA_MASCARA };
+
+const char* nomeModoValidacao(ModoValidacao modo) {
+    switch (modo) {
+        case ModoValidacao::THREAD_UNICA:       return "thread única";
+        case ModoValidacao::PARALELA:           return "paralela";
+        case ModoValidacao::PARALELA_DETALHADA: return "paralela detalhada";
+        default:                                return "máscaras";
+    }
+}
+
+} // namespace
+
+// Estado compartilhado pelas tarefas de uma validação assíncrona
+struct Sudoku::EstadoAssincrono {
+    explicit EstadoAssincrono(PoliticaValidacao politica) : contexto(politica) {}
+
+    ModoValidacao modo;
+    Tabuleiro instantaneo;      // cópia: o tabuleiro da sessão pode mudar durante a validação
+    uint64_t geracao;
+    TokenParada token;
+    bool medirContadores;
+    function<void(const ResultadoValidacaoAssincrona&)> aoConcluir;
+    promise<ResultadoValidacaoAssincrona> promessa;
+
+    chrono::high_resolution_clock::time_point inicio;
+    clock_t inicioCpu;
+    int numTarefas;
+    atomic<int> pendentes;
+    atomic<bool> valido;
+    atomic<long long> nsEmFila;
+    atomic<long long> nsExecutando;
+    atomic<long long> celulasVerificadas;
+    atomic<long long> conflitos;
+
+    mutex mtxContadores;
+    ContadoresHW contadores;   // soma das tarefas (protegida por mtxContadores)
+
+    ContextoValidacao contexto;   // achados das tarefas por unidade (modos paralelos)
+};
+
+// Nova geração do tabuleiro: as validações em curso viram obsoletas
+void Sudoku::tabuleiroAlterado() {
+    lock_guard<mutex> lock(mtx);
+    geracao++;
+    // Sem validações em andamento não há token a invalidar (evita alocar a cada setValor)
+    if (validacoesAssincronas > 0) {
+        fonteParada.solicitarParada();
+        fonteParada = FonteParada();
+    }
+}
+
+// Método para cancelar as validações assíncronas em andamento
+void Sudoku::cancelarValidacoes() {
+    lock_guard<mutex> lock(mtx);
+    if (validacoesAssincronas > 0) {
+        fonteParada.solicitarParada();
+        fonteParada = FonteParada();
+    }
+}
+
+// Método para obter a versão atual do tabuleiro
+uint64_t Sudoku::getGeracao() {
+    lock_guard<mutex> lock(mtx);
+    return geracao;
+}
+
+// Método para validar sem bloquear, em qualquer modo
+future<ResultadoValidacaoAssincrona> Sudoku::validarAssincrono(
+        ModoValidacao modo, function<void(const ResultadoValidacaoAssincrona&)> aoConcluir) {
+    RASTREAR("validarAssincrono", "validacao");
+
+    shared_ptr<EstadoAssincrono> e = make_shared<EstadoAssincrono>(politicaValidacao);
+    e->modo = modo;
+    e->instantaneo = matriz;
+    e->medirContadores = medirContadores;
+    e->aoConcluir = aoConcluir;
+    e->inicio = chrono::high_resolution_clock::now();
+    e->inicioCpu = std::clock();
+    e->valido.store(true);
+    e->nsEmFila.store(0);
+    e->nsExecutando.store(0);
+    e->celulasVerificadas.store(0);
+    e->conflitos.store(0);
+    future<ResultadoValidacaoAssincrona> futuro = e->promessa.get_future();
+
+    // Divisão em tarefas igual à dos modos síncronos: {tipo, início, fim}
+    vector<int> tarefas;
+    switch (modo) {
+        case ModoValidacao::THREAD_UNICA:
+            tarefas = { TAREFA_CELULAS, 0, 0 };
+            break;
+        case ModoValidacao::PARALELA:
+            tarefas = { TAREFA_COLUNAS, 0, LADO_TABULEIRO, TAREFA_LINHAS, 0, LADO_TABULEIRO };
+            for (int b = 0; b < LADO_TABULEIRO; b++) {
+                tarefas.insert(tarefas.end(), { TAREFA_BLOCOS, b, b + 1 });
+            }
+            break;
+        case ModoValidacao::PARALELA_DETALHADA:
+            for (int tipo : { TAREFA_LINHAS, TAREFA_COLUNAS, TAREFA_BLOCOS }) {
+                for (int u = 0; u < LADO_TABULEIRO; u++) {
+                    tarefas.insert(tarefas.end(), { tipo, u, u + 1 });
+                }
+            }
+            break;
+        case ModoValidacao::MASCARA:
+            tarefas = { TAREFA_MASCARA, 0, 0 };
+            break;
+    }
+    e->numTarefas = static_cast<int>(tarefas.size() / 3);
+    e->pendentes.store(e->numTarefas);
+
+    {
+        lock_guard<mutex> lock(mtx);
+        e->geracao = geracao;
+        e->token = fonteParada.token();
+        validacoesAssincronas++;
+    }
+
+    LOG_INFO("\n[Sistema] Validação assíncrona ({}) com {} tarefas iniciada.", nomeModoValidacao(modo), e->numTarefas);
+
+    for (size_t i = 0; i < tarefas.size(); i += 3) {
+        int tipo = tarefas[i], inicio = tarefas[i + 1], fim = tarefas[i + 2];
+        chrono::steady_clock::time_point agora = chrono::steady_clock::now();
+        pool->enviarAvulsa([this, e, tipo, inicio, fim, agora]() {
+            executarTarefaAssincrona(e, tipo, inicio, fim, agora);
+        });
+    }
+    return futuro;
+}
+
+// Executa uma tarefa de uma validação assíncrona; a última a terminar conclui a validação
+void Sudoku::executarTarefaAssincrona(const shared_ptr<EstadoAssincrono>& e, int tipo, int inicio, int fim,
+                                      chrono::steady_clock::time_point enfileiradaEm) {
+    auto comeco = chrono::steady_clock::now();
+    e->nsEmFila.fetch_add(chrono::duration_cast<chrono::nanoseconds>(comeco - enfileiradaEm).count());
+
+    // Validação já obsoleta: não gasta tempo verificando
+    if (!e->token.paradaSolicitada()) {
+        RASTREAR("tarefa assíncrona", "validacao");
+        GrupoContadores* grupo = e->medirContadores ? &GrupoContadores::daThread() : nullptr;
+        if (grupo) grupo->iniciar();
+
+        bool ok = true;
+        const Tabuleiro& t = e->instantaneo;
+        switch (tipo) {
+            case TAREFA_CELULAS: {
+                int verificadas = 0, conflitos = 0;
+                ok = varrerCelulas(t, e->token, verificadas, conflitos);
+                e->celulasVerificadas.fetch_add(verificadas);
+                e->conflitos.fetch_add(conflitos);
+                break;
+            }
+            case TAREFA_LINHAS:
+                ok = validarLinhas(t, inicio, fim, &e->contexto);
+                break;
+            case TAREFA_COLUNAS:
+                ok = validarColunas(t, inicio, fim, &e->contexto);
+                break;
+            case TAREFA_BLOCOS:
+                ok = validarBlocos(t, inicio, fim, &e->contexto);
+                break;
+            default: {
+                ResultadoMascara r = validarComMascaras(t.celulas);
+                ok = r.resultado == ResultadoValidacao::VALIDO;
+                e->celulasVerificadas.fetch_add(NUM_CELULAS * 3);
+                e->conflitos.fetch_add(r.numConflitos);
+                break;
+            }
+        }
+        if (!ok) {
+            e->valido.store(false);
+        }
+
+        if (grupo) {
+            ContadoresHW c = grupo->parar();
+            lock_guard<mutex> lock(e->mtxContadores);
+            e->contadores.somar(c);
+        }
+    }
+
+    e->nsExecutando.fetch_add(chrono::duration_cast<chrono::nanoseconds>(
+        chrono::steady_clock::now() - comeco).count());
+    if (e->pendentes.fetch_sub(1) == 1) {
+        concluirValidacaoAssincrona(e);
+    }
+}
+
+// Publica o resultado (se ainda for da geração atual), cumpre o futuro e chama aoConcluir
+void Sudoku::concluirValidacaoAssincrona(const shared_ptr<EstadoAssincrono>& e) {
+    auto fim = chrono::high_resolution_clock::now();
+
+    ResultadoValidacaoAssincrona r;
+    r.geracao = e->geracao;
+    r.valido = e->valido.load();
+    ValidacaoStats& st = r.stats;
+    st.tempoExecucao = chrono::duration_cast<chrono::milliseconds>(fim - e->inicio);
+    st.tempoEmNs = chrono::duration_cast<chrono::nanoseconds>(fim - e->inicio);
+    st.cpuTicks = std::clock() - e->inicioCpu;
+    st.numCelulasVerificadas = e->celulasVerificadas.load();
+    st.numConflitosEncontrados = e->conflitos.load();
+    if (e->modo == ModoValidacao::PARALELA || e->modo == ModoValidacao::PARALELA_DETALHADA) {
+        r.relatorio = e->contexto.relatorio();
+        st.numCelulasVerificadas = r.relatorio.numUnidadesVerificadas() * LADO_TABULEIRO;
+        st.numConflitosEncontrados = r.relatorio.numCelulasEmConflito();
+    }
+    st.numTarefas = e->numTarefas;
+    st.numThreadsUsadas = std::min<int>(e->numTarefas, pool->numThreads());
+    st.tempoEmFila = chrono::nanoseconds(e->nsEmFila.load());
+    st.tempoTarefas = chrono::nanoseconds(e->nsExecutando.load());
+    st.contadoresMedidos = e->medirContadores;
+    st.contadores = e->contadores;
+
+    {
+        lock_guard<mutex> lock(mtx);
+        r.cancelada = e->token.paradaSolicitada() || e->geracao != geracao;
+        if (!r.cancelada) {
+            ultimasStats = st;
+            ultimoRelatorio = r.relatorio;
+            isThreadValid = r.valido;
+            validacaoConcluida.store(true);
+        }
+    }
+
+    if (r.cancelada) {
+        LOG_INFO("[Sistema] Validação assíncrona ({}) da geração {} cancelada: o tabuleiro mudou.",
+                 nomeModoValidacao(e->modo), static_cast<long long>(e->geracao));
+    } else {
+        LOG_INFO("[Sistema] Validação assíncrona ({}) concluída em {}ns: o tabuleiro é {}",
+                 nomeModoValidacao(e->modo), st.tempoEmNs.count(), r.valido ? "válido" : "inválido");
+    }
+
+    e->promessa.set_value(r);
+    if (e->aoConcluir) {
+        e->aoConcluir(r);
+    }
+
+    // Último uso do objeto: depois disto o destrutor pode prosseguir
+    lock_guard<mutex> lock(mtx);
+    if (--validacoesAssincronas == 0) {
+        cv.notify_all();
+    }
+}
+
+// Métodos para escolher a política dos modos paralelos
+void Sudoku::setPoliticaValidacao(PoliticaValidacao politica) {
+    politicaValidacao = politica;
+}
+
+PoliticaValidacao Sudoku::getPoliticaValidacao() const {
+    return politicaValidacao;
+}
+
+// Método para obter o relatório de conflitos da última validação paralela
+RelatorioConflitos Sudoku::getUltimoRelatorio() {
+    lock_guard<mutex> lock(mtx);
+    return ultimoRelatorio;
+}
+
+// Método para ligar a medição dos contadores de hardware nas validações
+void Sudoku::setContadoresHardware(bool ativo) {
+    medirContadores = ativo;
+}
+
+// Método para trocar o pool de threads usado pela validação paralela
+void Sudoku::setThreadPool(shared_ptr<ThreadPool> novoPool) {
+    if (novoPool) {
+        pool = novoPool;
+    }
 }
 
 // Método para obter estatísticas da última validação
 ValidacaoStats Sudoku::getUltimasStats() const {
+    lock_guard<mutex> lock(mtx);
     return ultimasStats;
 }
 
+// Método para obter estatísticas da última resolução
+EstatisticasSolver Sudoku::getUltimasStatsSolver() const {
+    return ultimasStatsSolver;
+}
+
+// Método para obter o resultado da última resolução pelo portfólio
+ResultadoPortfolio Sudoku::getUltimoResultadoPortfolio() const {
+    return ultimoPortfolio;
+}
+
+namespace {
+
+// Escreve os eventos de um total, "indisponível" para os que não existem
+void imprimirEventosHW(const ContadoresHW& c) {
+    for (int e = 0; e < NUM_EVENTOS_HW; e++) {
+        EventoHW evento = static_cast<EventoHW>(e);
+        cout << (e ? ", " : "") << nomeEventoHW(evento) << " ";
+        if (c.temEvento(evento)) {
+            cout << c.get(evento);
+        } else {
+            cout << "indisponível";
+        }
+    }
+    if (c.ipc() > 0) {
+        cout << ", IPC " << c.ipc();
+    }
+    cout << endl;
+}
+
+// Seção de contadores de hardware do log detalhado
+void imprimirContadoresHW(const ValidacaoStats& stats) {
+    bool algumEvento = false;
+    for (int e = 0; e < NUM_EVENTOS_HW; e++) {
+        algumEvento = algumEvento || stats.contadores.temEvento(static_cast<EventoHW>(e));
+    }
+    if (!algumEvento) {
+        cout << "Contadores de hardware: indisponíveis (" << GrupoContadores::motivoIndisponivel() << ")" << endl;
+        return;
+    }
+
+    cout << "Contadores de hardware (total): ";
+    imprimirEventosHW(stats.contadores);
+    string motivo = GrupoContadores::motivoIndisponivel();
+    if (!motivo.empty()) {
+        cout << "  (" << motivo << ")" << endl;
+    }
+    for (const ContadoresThread& t : stats.contadoresPorThread) {
+        cout << "  Thread " << t.thread << " (" << t.tarefas << " tarefas): ";
+        imprimirEventosHW(t.contadores);
+    }
+}
+
+// Imprime o relatório de conflitos dos modos paralelos (linhas e colunas de 1 a 9)
+void imprimirRelatorio(const RelatorioConflitos& r) {
+    static const char* const TIPOS[3] = { "linha", "coluna", "bloco" };
+    cout << "Unidades verificadas: " << r.numUnidadesVerificadas() << "/" << NUM_UNIDADES
+         << (r.completo() ? "" : " (interrompida no primeiro problema)") << endl;
+
+    vector<int> unidades = r.listarUnidadesComConflito();
+    if (!unidades.empty()) {
+        cout << "Unidades com conflito:";
+        for (int u : unidades) {
+            cout << " " << TIPOS[u / LADO_TABULEIRO] << " " << u % LADO_TABULEIRO + 1 << " (dígitos";
+            for (int d = 1; d <= LADO_TABULEIRO; d++) {
+                if ((r.digitosRepetidos[u] >> d) & 1) cout << " " << d;
+            }
+            cout << ")";
+        }
+        cout << endl;
+        cout << "Células em conflito:";
+        for (int c : r.listarCelulasEmConflito()) {
+            cout << " (" << LINHA_DA_CELULA[c] + 1 << "," << COLUNA_DA_CELULA[c] + 1 << ")";
+        }
+        cout << endl;
+    }
+    if (r.unidadesIncompletas) {
+        cout << "Células vazias encontradas: " << r.numCelulasVazias() << endl;
+    }
+}
+
+} // namespace
+
 // Método para imprimir log detalhado da validação
 void Sudoku::imprimirLogValidacao() {
+    LogAssincrono::global().descarregar();
+
+    // Cópias tiradas sob mtx: uma validação assíncrona pode estar publicando
+    bool valido;
+    ValidacaoStats stats;
+    RelatorioConflitos relatorio;
+    {
+        lock_guard<mutex> lock(mtx);
+        valido = isThreadValid;
+        stats = ultimasStats;
+        relatorio = ultimoRelatorio;
+    }
+
     cout << "\n===== LOG DETALHADO DE VALIDAÇÃO =====" << endl;
-    cout << "Status: " << (isThreadValid ? "VÁLIDO" : "INVÁLIDO/INCOMPLETO") << endl;
-    cout << "Tempo de execução em ms: " << ultimasStats.tempoExecucao.count() << " ms" << endl;
-    cout << "Tempo de execução em ns: " << ultimasStats.tempoEmNs.count() << " ns" << endl;
-    cout << "CPU ticks: " << ultimasStats.cpuTicks << endl;
-    cout << "Células verificadas: "      << ultimasStats.numCelulasVerificadas << endl;
-    cout << "Conflitos encontrados: "    << ultimasStats.numConflitosEncontrados << endl;
-    cout << "Threads utilizadas: "      << ultimasStats.numThreadsUsadas << endl;
+    cout << "Status: " << (valido ? "VÁLIDO" : "INVÁLIDO/INCOMPLETO") << endl;
+    cout << "Tempo de execução em ms: " << stats.tempoExecucao.count() << " ms" << endl;
+    cout << "Tempo de execução em ns: " << stats.tempoEmNs.count() << " ns" << endl;
+    cout << "CPU ticks: " << stats.cpuTicks << endl;
+    cout << "Células verificadas: "      << stats.numCelulasVerificadas << endl;
+    cout << "Conflitos encontrados: "    << stats.numConflitosEncontrados << endl;
+    cout << "Threads utilizadas: "      << stats.numThreadsUsadas << endl;
+    cout << "Tarefas executadas: "      << stats.numTarefas << endl;
+    cout << "Tempo das tarefas na fila: " << stats.tempoEmFila.count() << " ns" << endl;
+    cout << "Tempo das tarefas executando: " << stats.tempoTarefas.count() << " ns" << endl;
+    if (stats.contadoresMedidos) {
+        imprimirContadoresHW(stats);
+    }
+    if (relatorio.numUnidadesVerificadas() > 0) {
+        imprimirRelatorio(relatorio);
+    }
+    // Conferência cruzada com o estado mantido incrementalmente por setValor
+    cout << "Estado incremental: " << (estado.isValido() ? "VÁLIDO" : "INVÁLIDO/INCOMPLETO")
+         << (estado.isValido() == valido ? " (confere)" : " (DIVERGENTE!)") << endl;
     cout << "=======================================" << endl;
 }
 
 // Construtor
-Sudoku::Sudoku() : isThreadValid(false), validacaoConcluida(false) {
+Sudoku::Sudoku() : isThreadValid(false), validacaoConcluida(false), medirContadores(false),
+                   politicaValidacao(PoliticaValidacao::RELATORIO), pool(ThreadPool::compartilhado()), geracao(0), validacoesAssincronas(0) {
     // Inicializar a matriz 9x9 com zeros
-    matriz.resize(9, vector<int>(9, 0));
+    matriz.limpar();
     
     // Inicializar estatísticas
     ultimasStats.tempoExecucao = chrono::milliseconds(0);
@@ -436,26 +765,58 @@ Sudoku::Sudoku() : isThreadValid(false), validacaoConcluida(false) {
     ultimasStats.numCelulasVerificadas = 0;
     ultimasStats.numConflitosEncontrados = 0;
     ultimasStats.numThreadsUsadas = 0;
+    ultimasStats.numTarefas = 0;
+    ultimasStats.tempoEmFila = chrono::nanoseconds(0);
+    ultimasStats.tempoTarefas = chrono::nanoseconds(0);
+
+    ultimasStatsSolver = SolverPropagacao().getEstatisticas();
+    ultimoPortfolio = SolverPortfolio(0).getResultado();
+    motorSolver = MotorSolver::PROPAGACAO;
+
+    // Única leitura de entropia do sistema: o resto vem do xoshiro
+    random_device rd;
+    rng.semear((static_cast<uint64_t>(rd()) << 32) | rd());
 }
 
 // Construtor com nível de dificuldade
-Sudoku::Sudoku(Dificuldade nivel) : isThreadValid(false), validacaoConcluida(false) {
+Sudoku::Sudoku(Dificuldade nivel) : isThreadValid(false), validacaoConcluida(false), medirContadores(false),
+                   politicaValidacao(PoliticaValidacao::RELATORIO), pool(ThreadPool::compartilhado()), geracao(0), validacoesAssincronas(0) {
     // Inicializar a matriz 9x9 com zeros
-    matriz.resize(9, vector<int>(9, 0));
+    matriz.limpar();
     
     // Inicializar estatísticas
     ultimasStats.tempoExecucao = chrono::milliseconds(0);
+    ultimasStats.tempoEmNs = chrono::nanoseconds(0);
+    ultimasStats.cpuTicks = 0;
     ultimasStats.numCelulasVerificadas = 0;
     ultimasStats.numConflitosEncontrados = 0;
     ultimasStats.numThreadsUsadas = 0;
+    ultimasStats.numTarefas = 0;
+    ultimasStats.tempoEmFila = chrono::nanoseconds(0);
+    ultimasStats.tempoTarefas = chrono::nanoseconds(0);
+
+    ultimasStatsSolver = SolverPropagacao().getEstatisticas();
+    ultimoPortfolio = SolverPortfolio(0).getResultado();
+    motorSolver = MotorSolver::PROPAGACAO;
+
+    // Única leitura de entropia do sistema: o resto vem do xoshiro
+    random_device rd;
+    rng.semear((static_cast<uint64_t>(rd()) << 32) | rd());
     
     inicializarJogo(nivel);
 }   
 
-// Destrutor - verifica se a thread é válida
+// Destrutor - cancela as validações assíncronas, espera por elas e verifica se a thread é válida
 Sudoku::~Sudoku() {
+    {
+        // As tarefas no pool ainda usam o objeto para publicar o resultado
+        unique_lock<mutex> lock(mtx);
+        fonteParada.solicitarParada();
+        cv.wait(lock, [this]() { return validacoesAssincronas == 0; });
+    }
     if (validationThread.joinable()) {
         validationThread.join();
+        LogAssincrono::global().descarregar();
         cout << "Thread de validação finalizada. Resultado: " 
              << (isThreadValid ? "Matriz válida" : "Matriz inválida") << endl;
     }
@@ -463,33 +824,62 @@ Sudoku::~Sudoku() {
 
 // Método para colocar um valor na matriz
 bool Sudoku::setValor(int row, int col, int value) {
-    if (row < 0 || row >= 9 || col < 0 || col >= 9 || value < 0 || value > 9) {
+    if (row < 0 || row >= LADO_TABULEIRO || col < 0 || col >= LADO_TABULEIRO ||
+        value < 0 || value > LADO_TABULEIRO) {
         cout << "Posição ou valor inválido!" << endl;
         return false;
     }
 
-    matriz[row][col] = value;
+    // Atualiza as contagens em O(1) antes de gravar o novo valor
+    estado.atualizar(row * LADO_TABULEIRO + col, matriz.get(row, col), static_cast<uint8_t>(value));
+    matriz.set(row, col, static_cast<uint8_t>(value));
+    tabuleiroAlterado();
     return true;
 }
 
 // Método para obter um valor da matriz
 int Sudoku::getValor(int row, int col) {
-    if (row < 0 || row >= 9 || col < 0 || col >= 9) {
+    if (row < 0 || row >= LADO_TABULEIRO || col < 0 || col >= LADO_TABULEIRO) {
         cout << "Posição inválida!" << endl;
         return -1;
     }
-    return matriz[row][col];
+    return matriz.get(row, col);
+}
+
+// Método para obter o tabuleiro atual (cópia barata: 81 bytes)
+const Tabuleiro& Sudoku::getTabuleiro() const {
+    return matriz;
+}
+
+// Método para trocar o tabuleiro inteiro de uma vez (ex.: saída de um solver)
+void Sudoku::setTabuleiro(const Tabuleiro& tabuleiro) {
+    matriz = tabuleiro;
+    estado.recalcular(matriz);
+    tabuleiroAlterado();
 }
 
 bool Sudoku::isComplete() const {
-    for (const auto& row : matriz) {
-        for (int v : row) {
-            if (v == 0) {
-                return false;
-            }
-        }
-    }
-    return true;
+    return estado.isComplete();
+}
+
+// Método para saber, em O(1), se o tabuleiro atual está completo e sem conflitos
+bool Sudoku::isValidoAtual() const {
+    return estado.isValido();
+}
+
+// Método para saber, em O(1), se algum dígito se repete em alguma unidade
+bool Sudoku::temConflitos() const {
+    return estado.temConflitos();
+}
+
+// Método para obter, em O(1), a máscara das unidades com conflito
+uint32_t Sudoku::unidadesEmConflito() const {
+    return estado.unidadesEmConflito();
+}
+
+// Método para obter, em O(1), o número de células vazias
+int Sudoku::numCelulasVazias() const {
+    return estado.numVazias();
 }
 
 // Método para iniciar a thread de validação
@@ -497,14 +887,19 @@ void Sudoku::iniciarValidacao() {
     if (validationThread.joinable()) {
         validationThread.join();
     }
+    RASTREAR("criar thread de validação", "validacao");
     validationThread = thread(&Sudoku::validationFunction, this);
 }
 
 // Método para verificar se a thread é válida
 bool Sudoku::isValidThread() {
     if (validationThread.joinable()) {
+        RASTREAR("join da thread de validação", "validacao");
         validationThread.join();
     }
+    // As mensagens da thread de validação saem antes do resultado
+    LogAssincrono::global().descarregar();
+    lock_guard<mutex> lock(mtx);
     return isThreadValid;
 }
 
@@ -512,41 +907,77 @@ bool Sudoku::isValidThread() {
 void Sudoku::completarMatriz(bool gerarMatrizValida) {
     if (gerarMatrizValida) {
         // Algoritmo para gerar uma matriz válida de Sudoku
-        random_device rd;
-        mt19937 g(rd());
-        
         // Limpar a matriz
-        for (int i = 0; i < 9; i++) {
-            for (int j = 0; j < 9; j++) {
-                matriz[i][j] = 0;
-            }
-        }
+        matriz.limpar();
         
         // Preencher a matriz usando backtracking
-        preencherMatrizValida(0, 0);
+        SolverBacktracking solver(rng());
+        solver.resolver(matriz);
     } else {
         // Gerar uma matriz inválida (com conflitos)
-        random_device rd;
-        mt19937 g(rd());
-        uniform_int_distribution<int> dist(1, 9);
-        
         // Preencher com valores aleatórios
-        for (int i = 0; i < 9; i++) {
-            for (int j = 0; j < 9; j++) {
-                matriz[i][j] = dist(g);
-            }
+        for (int i = 0; i < NUM_CELULAS; i++) {
+            matriz.celulas[i] = static_cast<uint8_t>(1 + rng.abaixoDe(LADO_TABULEIRO));
         }
     }
+
+    // A matriz foi reescrita inteira: recalcular o estado incremental
+    estado.recalcular(matriz);
+    tabuleiroAlterado();
 }
 
 // Método para completar a matriz atual mantendo os valores existentes
 void Sudoku::completarMatrizAtual(bool gerarMatrizValida) {
+    RASTREAR("completarMatrizAtual", "solver");
     if (gerarMatrizValida) {
         // Fazer uma cópia da matriz atual para preservar os valores existentes
-        vector<vector<int>> matrizOriginal = matriz;
+        // (Tabuleiro é trivialmente copiável: a cópia é um único memcpy)
+        Tabuleiro matrizOriginal = matriz;
         
-        // Tentar completar a matriz de forma válida usando backtracking
-        bool sucesso = preencherMatrizValida(0, 0);
+        // Tentar completar a matriz com o motor de solver escolhido
+        bool sucesso = false;
+        switch (motorSolver) {
+            case MotorSolver::BACKTRACKING: {
+                SolverBacktracking solver(rng());
+                sucesso = solver.resolver(matriz);
+                ultimasStatsSolver = solver.getEstatisticas();
+                break;
+            }
+            case MotorSolver::PROPAGACAO: {
+                SolverPropagacao solver;
+                sucesso = solver.resolver(matriz);
+                ultimasStatsSolver = solver.getEstatisticas();
+                break;
+            }
+            case MotorSolver::DLX: {
+                // ~40KB de nós pré-alocados: fica no heap, não na pilha
+                unique_ptr<SolverDLX> solver(new SolverDLX());
+                sucesso = solver->resolver(matriz);
+                ultimasStatsSolver = solver->getEstatisticas();
+                break;
+            }
+            case MotorSolver::PORTFOLIO: {
+                SolverPortfolio solver(rng());
+                sucesso = solver.resolver(matriz);
+                ultimasStatsSolver = solver.getEstatisticas();
+                ultimoPortfolio = solver.getResultado();
+                if (ultimoPortfolio.corrida) {
+                    LOG_INFO("[Solver] Portfólio: vencedora {} entre {} estratégias, {}ns na busca vencedora.",
+                             nomeEstrategiaSolver(ultimoPortfolio.vencedora), ultimoPortfolio.numEstrategias,
+                             ultimoPortfolio.statsVencedora.tempoEmNs.count());
+                } else {
+                    LOG_INFO("[Solver] Portfólio: decidido na tentativa inicial ({}), sem corrida.",
+                             nomeEstrategiaSolver(ultimoPortfolio.vencedora));
+                }
+                break;
+            }
+        }
+
+        LOG_INFO("[Solver] {} em {}ns, {} nós visitados, {} retrocessos, {} células propagadas.",
+                 sucesso ? "Resolvido" : "Sem solução", ultimasStatsSolver.tempoEmNs.count(),
+                 ultimasStatsSolver.nosVisitados, ultimasStatsSolver.retrocessos,
+                 ultimasStatsSolver.celulasPropagadas);
+        LogAssincrono::global().descarregar();
         
         if (!sucesso) {
             cout << "Não foi possível completar a matriz de forma válida com os valores atuais." << endl;
@@ -554,20 +985,36 @@ void Sudoku::completarMatrizAtual(bool gerarMatrizValida) {
             matriz = matrizOriginal;
         }
     } else {
-        // Gerar valores aleatórios para as células vazias
-        random_device rd;
-        mt19937 g(rd());
-        uniform_int_distribution<int> dist(1, 9);
-        
         // Preencher apenas as células vazias com valores aleatórios
-        for (int i = 0; i < 9; i++) {
-            for (int j = 0; j < 9; j++) {
-                if (matriz[i][j] == 0) {
-                    matriz[i][j] = dist(g);
-                }
+        for (int i = 0; i < NUM_CELULAS; i++) {
+            if (matriz.celulas[i] == 0) {
+                matriz.celulas[i] = static_cast<uint8_t>(1 + rng.abaixoDe(LADO_TABULEIRO));
             }
         }
     }
+
+    // Várias células mudaram de uma vez: recalcular o estado incremental
+    estado.recalcular(matriz);
+    tabuleiroAlterado();
+}
+
+// Método para enumerar as soluções da matriz atual sob demanda
+EnumeradorSolucoes Sudoku::enumerarSolucoes() const {
+    return EnumeradorSolucoes(matriz);
+}
+
+// Métodos para escolher o motor usado por completarMatrizAtual(true)
+void Sudoku::setMotorSolver(MotorSolver motor) {
+    motorSolver = motor;
+}
+
+MotorSolver Sudoku::getMotorSolver() const {
+    return motorSolver;
+}
+
+// Método para fixar a semente do gerador (jogos reproduzíveis)
+void Sudoku::setSemente(uint64_t semente) {
+    rng.semear(semente);
 }
 
 // Método para inicializar o jogo com um nível de dificuldade
@@ -581,83 +1028,14 @@ void Sudoku::inicializarJogo(Dificuldade nivel) {
 
 // Método para remover números da matriz de acordo com a dificuldade
 void Sudoku::ajustarDificuldade(Dificuldade nivel) {
-    int celulasParaRemover = 0;
-    int totalCelulas = 9 * 9; // 81 células no total
-    
-    // Definir quantas células remover baseado na dificuldade
-    switch (nivel) {
-        case Dificuldade::FACIL:
-            // Manter ~50% preenchido, remover ~50%
-            celulasParaRemover = static_cast<int>(totalCelulas * 0.5);
-            break;
-        case Dificuldade::MEDIO:
-            // Manter ~20% preenchido, remover ~80%
-            celulasParaRemover = static_cast<int>(totalCelulas * 0.8);
-            break;
-        case Dificuldade::DIFICIL:
-            // Manter ~10% preenchido, remover ~90%
-            celulasParaRemover = static_cast<int>(totalCelulas * 0.9);
-            break;
-    }
-    
-    // Criar uma lista de todas as posições
-    vector<pair<int, int>> posicoes;
-    for (int i = 0; i < 9; i++) {
-        for (int j = 0; j < 9; j++) {
-            posicoes.push_back(make_pair(i, j));
-        }
-    }
-    
-    // Embaralhar as posições
-    random_device rd;
-    mt19937 g(rd());
-    shuffle(posicoes.begin(), posicoes.end(), g);
-    
-    // Remover os números das primeiras 'celulasParaRemover' posições
-    for (int i = 0; i < celulasParaRemover && i < posicoes.size(); i++) {
-        int row = posicoes[i].first;
-        int col = posicoes[i].second;
-        matriz[row][col] = 0; // 0 representa célula vazia
-    }
-}
+    // Remover células uma a uma, mantendo apenas as remoções que preservam a
+    // solução única. Em MEDIO/DIFICIL o alvo fica abaixo do mínimo possível,
+    // e o gerador para quando nenhuma remoção mantém a unicidade.
+    GeradorPuzzles gerador(rng());
+    matriz = gerador.removerComUnicidade(matriz, pistasAlvo(nivel));
 
-// Método auxiliar para preencher a matriz válida usando backtracking
-bool Sudoku::preencherMatrizValida(int row, int col) {
-    // Se chegamos ao final da matriz, retornamos true
-    if (row == 9) {
-        return true;
-    }
-    
-    // Se chegamos ao final da linha, vamos para a próxima
-    if (col == 9) {
-        return preencherMatrizValida(row + 1, 0);
-    }
-    
-    // Se a célula já tem um valor, vamos para a próxima
-    if (matriz[row][col] != 0) {
-        return preencherMatrizValida(row, col + 1);
-    }
-    
-    // Tentar valores de 1 a 9
-    vector<int> values = {1, 2, 3, 4, 5, 6, 7, 8, 9};
-    random_device rd;
-    mt19937 g(rd());
-    shuffle(values.begin(), values.end(), g);
-    
-    for (int val : values) {
-        if (isValidValue(row, col, val)) {
-            matriz[row][col] = val;
-            
-            if (preencherMatrizValida(row, col + 1)) {
-                return true;
-            }
-            
-            // Se não conseguimos preencher, voltamos atrás
-            matriz[row][col] = 0;
-        }
-    }
-    
-    return false;
+    estado.recalcular(matriz);
+    tabuleiroAlterado();
 }
 
 // Método para imprimir a matriz
@@ -665,22 +1043,25 @@ void Sudoku::imprimirMatriz() {
     cout << "Estado atual do Sudoku:" << endl;
     cout << "    1 2 3   4 5 6   7 8 9" << endl;  // Índices das colunas
     cout << "  -------------------------" << endl;
-    for (int i = 0; i < 9; i++) {
+    for (int i = 0; i < LADO_TABULEIRO; i++) {
         cout << i + 1 << " | "; // Índice da linha (1-9)
-        for (int j = 0; j < 9; j++) {
-            if (matriz[i][j] == 0) {
+        for (int j = 0; j < LADO_TABULEIRO; j++) {
+            int valor = matriz.get(i, j);
+            if (valor == 0) {
                 cout << ". ";
             } else {
-                cout << matriz[i][j] << " ";
+                cout << valor << " ";
             }
-            if (j % 3 == 2 && j < 8) {
+            if (j % LADO_BLOCO == LADO_BLOCO - 1 && j < LADO_TABULEIRO - 1) {
                 cout << "| ";
             }
         }
         cout << "|" << endl;
-        if (i % 3 == 2 && i < 8) {
+        if (i % LADO_BLOCO == LADO_BLOCO - 1 && i < LADO_TABULEIRO - 1) {
             cout << "  |-------+-------+-------|" << endl;
         }
     }
     cout << "  -------------------------" << endl;
+    cout << "Células vazias: " << estado.numVazias()
+         << " | Unidades com conflito: " << __builtin_popcount(estado.unidadesEmConflito()) << endl;
 }
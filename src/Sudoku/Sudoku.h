@@ -9,62 +9,107 @@
 #include <condition_variable>
 #include <future>
 #include <string>
+#include <memory>
+#include <functional>
+#include "../ThreadPool/ThreadPool.h"
+#include "../ThreadPool/TokenParada.h"
+#include "../Tabuleiro/Tabuleiro.h"
+#include "../Tabuleiro/EstadoIncremental.h"
+#include "../Validador/ValidadorMascara.h"
+#include "../Validador/ValidacaoStats.h"
+#include "../Solver/SolverPropagacao.h"
+#include "../Solver/SolverDLX.h"
+#include "../Solver/SolverBacktracking.h"
+#include "../Solver/SolverPortfolio.h"
+#include "../Solver/EnumeradorSolucoes.h"
+#include "../Validador/ValidadorUnidades.h"
+#include "../Gerador/GeradorPuzzles.h"
+#include "../Gerador/Dificuldade.h"
+#include "../Gerador/Xoshiro.h"
+#include "../Log/LogAssincrono.h"
 
 using std::vector;
 using std::string;
 
-// Enum para os níveis de dificuldade
-enum class Dificuldade {
-    FACIL,   // ~50% preenchido
-    MEDIO,   // ~20% preenchido
-    DIFICIL  // ~10% preenchido
+// Enum para os motores de solver usados ao completar o tabuleiro
+enum class MotorSolver {
+    BACKTRACKING,  // SolverBacktracking: ordem de linhas, sem propagação
+    PROPAGACAO,    // SolverPropagacao: singles + MRV
+    DLX,           // SolverDLX: cobertura exata com Dancing Links
+    PORTFOLIO      // SolverPortfolio: estratégias em corrida, a primeira cancela as outras
 };
 
-// Struct para armazenar estatísticas de validação
-struct ValidacaoStats {
-    std::chrono::milliseconds tempoExecucao;
-    std::chrono::nanoseconds tempoEmNs;
-    std::clock_t cpuTicks;
-    int numCelulasVerificadas;
-    int numConflitosEncontrados;
-    int numThreadsUsadas;
+// Modos de validação, para a API assíncrona
+enum class ModoValidacao {
+    THREAD_UNICA,        // varredura célula a célula em uma tarefa
+    PARALELA,            // 11 tarefas: linhas, colunas e uma por bloco
+    PARALELA_DETALHADA,  // 27 tarefas: uma por unidade
+    MASCARA              // máscaras de bits (kernel SIMD) em uma tarefa
 };
 
+// Resultado de uma validação assíncrona
+struct ResultadoValidacaoAssincrona {
+    bool cancelada;          // interrompida ou superada por uma alteração do tabuleiro
+    bool valido;             // só tem significado se a validação não foi cancelada
+    uint64_t geracao;        // versão do tabuleiro que foi validada
+    ValidacaoStats stats;
+    RelatorioConflitos relatorio;   // preenchido nos modos PARALELA e PARALELA_DETALHADA
+};
+
+// Sessão de jogo: um tabuleiro (Tabuleiro, valor de 81 bytes) mais o estado
+// de threads, estatísticas e gerador aleatório da partida. Os motores
+// (validadores, solvers e gerador) trabalham direto sobre Tabuleiro, sem
+// depender desta classe nem de sincronização; para processar muitos
+// tabuleiros, use-os sobre vetores de Tabuleiro em vez de objetos Sudoku.
 class Sudoku {
 private:
-    vector<vector<int>> matriz;
+    Tabuleiro matriz;
+    EstadoIncremental estado;   // contagens por unidade, atualizadas em setValor
     std::thread validationThread;
     bool isThreadValid;
-    std::mutex mtx;
+    mutable std::mutex mtx;
     std::condition_variable cv;
     std::atomic<bool> validacaoConcluida;
     ValidacaoStats ultimasStats;
+    EstatisticasSolver ultimasStatsSolver;
+    MotorSolver motorSolver;
+    ResultadoPortfolio ultimoPortfolio;   // da última resolução com MotorSolver::PORTFOLIO
+    Xoshiro256 rng;              // semeado uma única vez no construtor
+    bool medirContadores;        // contadores de hardware nas validações (perf_event_open)
+    PoliticaValidacao politicaValidacao;   // dos modos paralelos
+    RelatorioConflitos ultimoRelatorio;    // da última validação paralela (protegido por mtx)
     
-    // Vetor de threads para validação paralela
-    vector<std::thread> threadsValidacao;
+    // Pool de threads (compartilhado por padrão) usado pela validação paralela
+    std::shared_ptr<ThreadPool> pool;
     vector<std::future<bool>> futurosValidacao;
 
-    // Método para verificar se um valor é válido em uma posição específica
-    bool isValidValue(int row, int col, int value);
+    // Validações assíncronas (protegidos por mtx). A geração muda a cada
+    // alteração do tabuleiro; uma validação só publica em ultimasStats se a
+    // geração que ela validou ainda for a atual e ninguém pediu parada.
+    struct EstadoAssincrono;
+    uint64_t geracao;
+    FonteParada fonteParada;        // cancela as validações da geração atual
+    int validacoesAssincronas;      // em andamento (o destrutor espera por elas)
+
+    // Chamado a cada alteração do tabuleiro: nova geração e parada das validações em curso
+    void tabuleiroAlterado();
+
+    // Executa uma tarefa de uma validação assíncrona; a última a terminar conclui a validação
+    void executarTarefaAssincrona(const std::shared_ptr<EstadoAssincrono>& e, int tipo, int inicio, int fim,
+                                  std::chrono::steady_clock::time_point enfileiradaEm);
+    void concluirValidacaoAssincrona(const std::shared_ptr<EstadoAssincrono>& e);
+
+    // Preenche as estatísticas e o relatório comuns aos dois modos paralelos
+    void registrarStatsParalelas(const ThreadPool::Lote& lote,
+                                 std::chrono::high_resolution_clock::time_point inicio,
+                                 std::clock_t inicioCpu, const RelatorioConflitos& relatorio);
+
+    // Preenche os contadores de hardware dos modos que rodam em uma única thread
+    void registrarContadoresThreadUnica(bool medidos, const ContadoresHW& contadores);
 
     // Função que será executada pela thread de validação
     void validationFunction();
-    
-    // Função para validar uma parte da matriz (para paralelismo)
-    bool validarParteMatriz(int startRow, int endRow);
-    
-    // Função para validar linhas
-    bool validarLinhas(int startRow, int endRow);
-    
-    // Função para validar colunas
-    bool validarColunas(int startCol, int endCol);
-    
-    // Função para validar blocos 3x3
-    bool validarBlocos(int startBlock, int endBlock);
 
-    // Método auxiliar para preencher a matriz válida usando backtracking
-    bool preencherMatrizValida(int row, int col);
-    
     // Método para remover números da matriz de acordo com a dificuldade
     void ajustarDificuldade(Dificuldade nivel);
 
@@ -84,30 +129,104 @@ public:
     // Método para obter um valor da matriz
     int getValor(int row, int col);
 
+    // Métodos para ler ou trocar o tabuleiro inteiro (valor trivialmente
+    // copiável, usado diretamente por validadores, solvers e gerador)
+    const Tabuleiro& getTabuleiro() const;
+    void setTabuleiro(const Tabuleiro& tabuleiro);
+
     // Método para retornar true se não houver nenhuma célula vazia (valor 0)
     bool isComplete() const;
 
+    // Método para saber, em O(1), se o tabuleiro atual está completo e sem conflitos
+    bool isValidoAtual() const;
+
+    // Método para saber, em O(1), se algum dígito se repete em alguma unidade
+    bool temConflitos() const;
+
+    // Método para obter, em O(1), a máscara das unidades com conflito
+    // (bits 0-8 linhas, 9-17 colunas, 18-26 blocos)
+    uint32_t unidadesEmConflito() const;
+
+    // Método para obter, em O(1), o número de células vazias
+    int numCelulasVazias() const;
+
     // Método para iniciar a thread de validação
     void iniciarValidacao();
     
-    // Método para iniciar validação paralela com 11 threads
+    // Método para iniciar validação paralela com 11 tarefas no pool
     void iniciarValidacaoParalela();
 
-    // Método para iniciar validação paralela com 27 threads
+    // Método para iniciar validação paralela com 27 tarefas no pool
     void iniciarValidacaoParalelaDetalhada();
 
+    // Método para validar com máscaras de bits (kernel SIMD escolhido em tempo de execução)
+    void iniciarValidacaoMascara();
+
+    // Método para validar sem bloquear, em qualquer modo. A validação usa uma
+    // cópia do tabuleiro e roda no pool; o futuro (e a função aoConcluir, se
+    // houver, chamada em uma thread do pool) recebe o resultado. Uma alteração
+    // do tabuleiro (setValor, completarMatriz...) ou cancelarValidacoes()
+    // interrompe as validações em curso, que terminam como canceladas e não
+    // alteram ultimasStats.
+    std::future<ResultadoValidacaoAssincrona> validarAssincrono(
+        ModoValidacao modo,
+        std::function<void(const ResultadoValidacaoAssincrona&)> aoConcluir =
+            std::function<void(const ResultadoValidacaoAssincrona&)>());
+
+    // Método para cancelar as validações assíncronas em andamento
+    void cancelarValidacoes();
+
+    // Método para obter a versão atual do tabuleiro (muda a cada alteração)
+    uint64_t getGeracao();
+
+    // Método para ligar a medição dos contadores de hardware (ciclos, instruções,
+    // faltas de cache, erros de desvio e trocas de contexto) por validação e por
+    // thread. Desligada por padrão; sem suporte no sistema, os eventos ficam -1.
+    void setContadoresHardware(bool ativo);
+
+    // Métodos para escolher o que os modos paralelos fazem ao achar um problema:
+    // RELATORIO (padrão) verifica tudo e lista cada conflito; PARAR_NO_PRIMEIRO
+    // interrompe as tarefas restantes no primeiro conflito ou célula vazia
+    void setPoliticaValidacao(PoliticaValidacao politica);
+    PoliticaValidacao getPoliticaValidacao() const;
+
+    // Método para obter o relatório de conflitos da última validação paralela
+    // (vazio depois dos modos de thread única e de máscaras)
+    RelatorioConflitos getUltimoRelatorio();
+
+    // Método para trocar o pool de threads usado pela validação paralela
+    void setThreadPool(std::shared_ptr<ThreadPool> novoPool);
+
     // Método para verificar se a thread é válida
     bool isValidThread();
     
     // Método para obter estatísticas da última validação
     ValidacaoStats getUltimasStats() const;
 
+    // Método para obter estatísticas da última resolução (completarMatrizAtual)
+    EstatisticasSolver getUltimasStatsSolver() const;
+
+    // Método para obter o resultado da última resolução pelo portfólio
+    // (estratégia vencedora); só tem significado com MotorSolver::PORTFOLIO
+    ResultadoPortfolio getUltimoResultadoPortfolio() const;
+
     // Método para completar a matriz (válida ou inválida)
     void completarMatriz(bool gerarMatrizValida);
     
     // Método para completar a matriz atual mantendo os valores existentes
     void completarMatrizAtual(bool gerarMatrizValida);
+
+    // Método para enumerar as soluções da matriz atual sob demanda, sem alterá-la
+    // (o enumerador guarda uma cópia do tabuleiro)
+    EnumeradorSolucoes enumerarSolucoes() const;
+
+    // Métodos para escolher o motor usado por completarMatrizAtual(true)
+    void setMotorSolver(MotorSolver motor);
+    MotorSolver getMotorSolver() const;
     
+    // Método para fixar a semente do gerador (jogos reproduzíveis)
+    void setSemente(uint64_t semente);
+
     // Método para inicializar o jogo com um nível de dificuldade
     void inicializarJogo(Dificuldade nivel);
 
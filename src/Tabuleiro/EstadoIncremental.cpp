@@ -0,0 +1,65 @@
+#include "EstadoIncremental.h"
+#include <cstring>
+
+using namespace std;
+
+// Construtor - estado de um tabuleiro vazio
+EstadoIncremental::EstadoIncremental() {
+    Tabuleiro vazio;
+    vazio.limpar();
+    recalcular(vazio);
+}
+
+void EstadoIncremental::recalcular(const Tabuleiro& tabuleiro) {
+    memset(contagem, 0, sizeof(contagem));
+    memset(digitosRepetidos, 0, sizeof(digitosRepetidos));
+    mascaraConflitos = 0;
+    vazias = 81;
+
+    for (int i = 0; i < 81; i++) {
+        atualizar(i, 0, tabuleiro.celulas[i]);
+    }
+}
+
+void EstadoIncremental::atualizar(int indice, uint8_t valorAntigo, uint8_t valorNovo) {
+    if (valorAntigo == valorNovo) {
+        return;
+    }
+
+    int linha = UNIDADES_DA_CELULA[indice][0];
+    int coluna = UNIDADES_DA_CELULA[indice][1];
+    int bloco = UNIDADES_DA_CELULA[indice][2];
+
+    if (valorAntigo != 0) {
+        decrementar(linha, valorAntigo);
+        decrementar(coluna, valorAntigo);
+        decrementar(bloco, valorAntigo);
+    } else {
+        vazias--;
+    }
+
+    if (valorNovo != 0) {
+        incrementar(linha, valorNovo);
+        incrementar(coluna, valorNovo);
+        incrementar(bloco, valorNovo);
+    } else {
+        vazias++;
+    }
+}
+
+// Um dígito passa a ser repetido quando sua contagem chega a 2
+void EstadoIncremental::incrementar(int unidade, uint8_t valor) {
+    if (++contagem[unidade][valor] == 2) {
+        digitosRepetidos[unidade]++;
+        mascaraConflitos |= 1u << unidade;
+    }
+}
+
+// E deixa de ser repetido quando volta para 1
+void EstadoIncremental::decrementar(int unidade, uint8_t valor) {
+    if (contagem[unidade][valor]-- == 2) {
+        if (--digitosRepetidos[unidade] == 0) {
+            mascaraConflitos &= ~(1u << unidade);
+        }
+    }
+}
@@ -0,0 +1,49 @@
+#ifndef ESTADOINCREMENTAL_H
+#define ESTADOINCREMENTAL_H
+
+#include <cstdint>
+#include "Tabuleiro.h"
+
+// Estado de validade mantido incrementalmente a cada jogada.
+// Guarda a contagem de cada dígito em cada uma das 27 unidades e o número de
+// células vazias, de modo que "está completo?", "é válido?" e "quais unidades
+// têm conflito?" são respondidos em tempo constante, sem varrer o tabuleiro.
+class EstadoIncremental {
+public:
+    EstadoIncremental();
+
+    // Recalcula tudo a partir do tabuleiro - O(81), usado após operações em lote
+    void recalcular(const Tabuleiro& tabuleiro);
+
+    // Atualiza o estado para a troca de um valor em uma célula - O(1)
+    void atualizar(int indice, uint8_t valorAntigo, uint8_t valorNovo);
+
+    // Número de células vazias
+    int numVazias() const { return vazias; }
+
+    // Método para retornar true se não houver nenhuma célula vazia
+    bool isComplete() const { return vazias == 0; }
+
+    // Método para retornar true se algum dígito se repete em alguma unidade
+    bool temConflitos() const { return mascaraConflitos != 0; }
+
+    // Método para retornar true se o tabuleiro está completo e sem conflitos
+    bool isValido() const { return vazias == 0 && mascaraConflitos == 0; }
+
+    // Máscara das unidades com conflito: bits 0-8 linhas, 9-17 colunas, 18-26 blocos
+    uint32_t unidadesEmConflito() const { return mascaraConflitos; }
+
+    // Quantidade de vezes que um valor aparece em uma unidade
+    int contagemNaUnidade(int unidade, int valor) const { return contagem[unidade][valor]; }
+
+private:
+    uint8_t contagem[27][10];         // contagem[unidade][dígito]
+    uint8_t digitosRepetidos[27];     // dígitos que aparecem 2+ vezes em cada unidade
+    uint32_t mascaraConflitos;
+    int vazias;
+
+    void incrementar(int unidade, uint8_t valor);
+    void decrementar(int unidade, uint8_t valor);
+};
+
+#endif // ESTADOINCREMENTAL_H
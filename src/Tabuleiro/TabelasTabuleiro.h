@@ -0,0 +1,131 @@
+#ifndef TABELASTABULEIRO_H
+#define TABELASTABULEIRO_H
+
+#include <cstdint>
+
+// Dimensões do tabuleiro clássico (variantes maiores ficam em TabuleiroN.h)
+const int LADO_BLOCO = 3;
+const int LADO_TABULEIRO = LADO_BLOCO * LADO_BLOCO;
+const int NUM_CELULAS = LADO_TABULEIRO * LADO_TABULEIRO;
+const int NUM_UNIDADES = 3 * LADO_TABULEIRO;
+
+// Vizinhos de uma célula: as outras células da linha, da coluna e do bloco (20 no 9x9)
+const int NUM_VIZINHOS = 2 * (LADO_TABULEIRO - 1) + (LADO_BLOCO - 1) * (LADO_BLOCO - 1);
+
+// Tabelas de índices do tabuleiro armazenado linha a linha (índice = linha * 9 + coluna),
+// geradas em tempo de compilação a partir das fórmulas abaixo. Por serem
+// constexpr no cabeçalho, o compilador conhece o conteúdo em todo uso e pode
+// dobrar índices constantes e desenrolar os laços sobre elas.
+namespace tabelas {
+
+constexpr int linha(int celula) { return celula / LADO_TABULEIRO; }
+constexpr int coluna(int celula) { return celula % LADO_TABULEIRO; }
+constexpr int bloco(int celula) {
+    return linha(celula) / LADO_BLOCO * LADO_BLOCO + coluna(celula) / LADO_BLOCO;
+}
+
+// Célula p (0-8) da unidade u: 0-8 linhas, 9-17 colunas, 18-26 blocos 3x3
+constexpr int celulaDaUnidade(int u, int p) {
+    return u < LADO_TABULEIRO ? u * LADO_TABULEIRO + p
+         : u < 2 * LADO_TABULEIRO ? p * LADO_TABULEIRO + (u - LADO_TABULEIRO)
+         : ((u - 2 * LADO_TABULEIRO) / LADO_BLOCO * LADO_BLOCO + p / LADO_BLOCO) * LADO_TABULEIRO
+           + (u - 2 * LADO_TABULEIRO) % LADO_BLOCO * LADO_BLOCO + p % LADO_BLOCO;
+}
+
+// Unidade k (0 linha, 1 coluna, 2 bloco) da célula, na numeração acima
+constexpr int unidadeDaCelula(int celula, int k) {
+    return k * LADO_TABULEIRO + (k == 0 ? linha(celula) : k == 1 ? coluna(celula) : bloco(celula));
+}
+
+// i-ésimo índice em 0..LADO-1 pulando 'excluido' (as outras posições de uma linha ou coluna)
+constexpr int pulando(int i, int excluido) { return i < excluido ? i : i + 1; }
+
+// i-ésima linha (ou coluna) do bloco de 'x' diferente de 'x' (i = 0 ou 1)
+constexpr int outraDoBloco(int x, int i) {
+    return x / LADO_BLOCO * LADO_BLOCO + pulando(i, x % LADO_BLOCO);
+}
+
+// Vizinho k da célula: 8 da linha, depois 8 da coluna, depois os 4 do bloco
+// fora da linha e da coluna, cada grupo em ordem crescente de índice
+constexpr int vizinho(int celula, int k) {
+    return k < LADO_TABULEIRO - 1
+             ? linha(celula) * LADO_TABULEIRO + pulando(k, coluna(celula))
+         : k < 2 * (LADO_TABULEIRO - 1)
+             ? pulando(k - (LADO_TABULEIRO - 1), linha(celula)) * LADO_TABULEIRO + coluna(celula)
+         : outraDoBloco(linha(celula), (k - 2 * (LADO_TABULEIRO - 1)) / (LADO_BLOCO - 1)) * LADO_TABULEIRO
+           + outraDoBloco(coluna(celula), (k - 2 * (LADO_TABULEIRO - 1)) % (LADO_BLOCO - 1));
+}
+
+// Sequência de inteiros 0..N-1 (std::index_sequence só existe a partir do C++14),
+// gerada por duplicação para não passar do limite de recursão de templates
+template <int... I> struct Indices {};
+
+template <class A, class B> struct Concatenar;
+template <int... I, int... J> struct Concatenar<Indices<I...>, Indices<J...> > {
+    typedef Indices<I..., (static_cast<int>(sizeof...(I)) + J)...> tipo;
+};
+
+template <int N> struct GerarIndices {
+    typedef typename Concatenar<typename GerarIndices<N / 2>::tipo,
+                                typename GerarIndices<N - N / 2>::tipo>::tipo tipo;
+};
+template <> struct GerarIndices<0> { typedef Indices<> tipo; };
+template <> struct GerarIndices<1> { typedef Indices<0> tipo; };
+
+// Arrays não podem ser retornados por funções constexpr: cada tabela vai em uma struct
+template <int N> struct Tabela1D { uint8_t v[N]; };
+template <int L, int C> struct Tabela2D { uint8_t v[L][C]; };
+
+template <int... I>
+constexpr Tabela1D<sizeof...(I)> gerar1D(int (*f)(int), Indices<I...>) {
+    return Tabela1D<sizeof...(I)>{ { static_cast<uint8_t>(f(I))... } };
+}
+
+// Preenche a tabela L x C linha a linha com f(i / C, i % C); as chaves de
+// cada linha são omitidas (as L * C entradas vêm em uma lista só)
+template <int L, int C, int... I>
+constexpr Tabela2D<L, C> gerar2D(int (*f)(int, int), Indices<I...>) {
+    return Tabela2D<L, C>{ { static_cast<uint8_t>(f(I / C, I % C))... } };
+}
+
+template <int L, int C>
+constexpr Tabela2D<L, C> gerar2D(int (*f)(int, int)) {
+    return gerar2D<L, C>(f, typename GerarIndices<L * C>::tipo());
+}
+
+constexpr Tabela1D<NUM_CELULAS> LINHAS = gerar1D(linha, GerarIndices<NUM_CELULAS>::tipo());
+constexpr Tabela1D<NUM_CELULAS> COLUNAS = gerar1D(coluna, GerarIndices<NUM_CELULAS>::tipo());
+constexpr Tabela1D<NUM_CELULAS> BLOCOS = gerar1D(bloco, GerarIndices<NUM_CELULAS>::tipo());
+constexpr Tabela2D<NUM_UNIDADES, LADO_TABULEIRO> UNIDADES =
+    gerar2D<NUM_UNIDADES, LADO_TABULEIRO>(celulaDaUnidade);
+constexpr Tabela2D<NUM_CELULAS, 3> UNIDADES_POR_CELULA = gerar2D<NUM_CELULAS, 3>(unidadeDaCelula);
+constexpr Tabela2D<NUM_CELULAS, NUM_VIZINHOS> VIZINHOS = gerar2D<NUM_CELULAS, NUM_VIZINHOS>(vizinho);
+
+} // namespace tabelas
+
+// Nomes públicos das tabelas. Uma referência não ganha ligação interna por
+// ser const, como os objetos acima: sem o static, cada .cpp a definiria de novo.
+
+// Linha, coluna e bloco de cada célula
+static constexpr const uint8_t (&LINHA_DA_CELULA)[NUM_CELULAS] = tabelas::LINHAS.v;
+static constexpr const uint8_t (&COLUNA_DA_CELULA)[NUM_CELULAS] = tabelas::COLUNAS.v;
+static constexpr const uint8_t (&BLOCO_DA_CELULA)[NUM_CELULAS] = tabelas::BLOCOS.v;
+
+// Células de cada unidade: 0-8 linhas, 9-17 colunas, 18-26 blocos 3x3
+static constexpr const uint8_t (&CELULAS_DA_UNIDADE)[NUM_UNIDADES][LADO_TABULEIRO] = tabelas::UNIDADES.v;
+
+// Unidades de cada célula na mesma numeração: { linha, 9 + coluna, 18 + bloco }
+static constexpr const uint8_t (&UNIDADES_DA_CELULA)[NUM_CELULAS][3] = tabelas::UNIDADES_POR_CELULA.v;
+
+// Os 20 vizinhos de cada célula (sem repetição e sem a própria célula)
+static constexpr const uint8_t (&VIZINHOS_DA_CELULA)[NUM_CELULAS][NUM_VIZINHOS] = tabelas::VIZINHOS.v;
+
+// Conferências em tempo de compilação contra valores conhecidos
+static_assert(BLOCO_DA_CELULA[80] == 8 && BLOCO_DA_CELULA[30] == 4, "tabela de blocos");
+static_assert(CELULAS_DA_UNIDADE[10][8] == 73 && CELULAS_DA_UNIDADE[22][4] == 40, "tabela de unidades");
+static_assert(UNIDADES_DA_CELULA[40][0] == 4 && UNIDADES_DA_CELULA[40][1] == 13 &&
+              UNIDADES_DA_CELULA[40][2] == 22, "tabela de unidades por célula");
+static_assert(VIZINHOS_DA_CELULA[0][7] == 8 && VIZINHOS_DA_CELULA[0][8] == 9 &&
+              VIZINHOS_DA_CELULA[0][16] == 10 && VIZINHOS_DA_CELULA[40][19] == 50, "tabela de vizinhos");
+
+#endif // TABELASTABULEIRO_H
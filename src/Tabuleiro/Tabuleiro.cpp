@@ -0,0 +1,37 @@
+#include "Tabuleiro.h"
+#include <cstring>
+
+using namespace std;
+
+// Método para esvaziar o tabuleiro
+void Tabuleiro::limpar() {
+    memset(celulas, 0, sizeof(celulas));
+}
+
+// Método para retornar true se não houver nenhuma célula vazia
+bool Tabuleiro::isComplete() const {
+    return memchr(celulas, 0, sizeof(celulas)) == nullptr;
+}
+
+// Método para ler 81 caracteres ('1'-'9', e '.' ou '0' para vazio)
+bool Tabuleiro::carregarTexto(const char* texto) {
+    for (int i = 0; i < 81; i++) {
+        char c = texto[i];
+        if (c >= '1' && c <= '9') {
+            celulas[i] = static_cast<uint8_t>(c - '0');
+        } else if (c == '.' || c == '0') {
+            celulas[i] = 0;
+        } else {
+            return false; // inclui o '\0' de textos curtos
+        }
+    }
+    return true;
+}
+
+// Método para escrever o tabuleiro em 81 caracteres ('.' = vazio)
+void Tabuleiro::paraTexto(char saida[82]) const {
+    for (int i = 0; i < 81; i++) {
+        saida[i] = celulas[i] ? static_cast<char>('0' + celulas[i]) : '.';
+    }
+    saida[81] = '\0';
+}
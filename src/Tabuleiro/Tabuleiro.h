@@ -0,0 +1,51 @@
+#ifndef TABULEIRO_H
+#define TABULEIRO_H
+
+#include <cstdint>
+#include <type_traits>
+#include "TabelasTabuleiro.h"
+
+// Tabuleiro 9x9 contíguo: 81 células de 1 byte armazenadas linha a linha
+// (índice = linha * 9 + coluna, 0 = vazio). Alinhado a 32 bytes, ocupa no
+// máximo duas linhas de cache e é copiado com um único memcpy.
+struct alignas(32) Tabuleiro {
+    uint8_t celulas[NUM_CELULAS];
+
+    // Método para obter o valor de uma célula
+    uint8_t get(int row, int col) const { return celulas[row * LADO_TABULEIRO + col]; }
+
+    // Método para colocar um valor em uma célula
+    void set(int row, int col, uint8_t value) { celulas[row * LADO_TABULEIRO + col] = value; }
+
+    // Método para esvaziar o tabuleiro
+    void limpar();
+
+    // Método para retornar true se não houver nenhuma célula vazia
+    bool isComplete() const;
+
+    // Método para verificar se 'value' pode ficar em (row, col) sem repetir
+    // na linha, na coluna ou no bloco (a própria célula é ignorada). Percorre
+    // os 20 vizinhos da tabela, sem os testes de "é a própria célula" nem as
+    // contas de início do bloco; inline por estar no laço interno dos solvers.
+    bool podeColocar(int row, int col, int value) const {
+        const uint8_t* vizinhos = VIZINHOS_DA_CELULA[row * LADO_TABULEIRO + col];
+        for (int k = 0; k < NUM_VIZINHOS; k++) {
+            if (celulas[vizinhos[k]] == value) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // Método para ler 81 caracteres ('1'-'9', e '.' ou '0' para vazio).
+    // Retorna false se o texto for curto ou tiver caracteres inválidos.
+    bool carregarTexto(const char* texto);
+
+    // Método para escrever o tabuleiro em 81 caracteres ('.' = vazio) + '\0'
+    void paraTexto(char saida[82]) const;
+};
+
+static_assert(sizeof(Tabuleiro) <= 128, "Tabuleiro deve caber em duas linhas de cache");
+static_assert(std::is_trivially_copyable<Tabuleiro>::value, "Tabuleiro deve ser copiável com memcpy");
+
+#endif // TABULEIRO_H
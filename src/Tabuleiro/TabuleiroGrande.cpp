@@ -0,0 +1,48 @@
+#include "TabuleiroGrande.h"
+#include <algorithm>
+
+using namespace std;
+
+// Construtor
+TabuleiroGrande::TabuleiroGrande(int ladoBloco)
+    : ladoBloco(ladoBloco), lado(ladoBloco * ladoBloco),
+      celulas(static_cast<size_t>(ladoBloco) * ladoBloco * ladoBloco * ladoBloco, 0) {}
+
+void TabuleiroGrande::limpar() {
+    fill(celulas.begin(), celulas.end(), 0);
+}
+
+void TabuleiroGrande::preencherValido(Xoshiro256& rng) {
+    const int B = ladoBloco;
+    const int N = lado;
+
+    vector<int> digitos(N), faixas(B), pilhas(B), linhas(N), colunas(N), dentro(B);
+    for (int d = 0; d < N; d++) {
+        digitos[d] = d + 1;
+    }
+    for (int k = 0; k < B; k++) {
+        faixas[k] = k;
+        pilhas[k] = k;
+    }
+    rng.embaralhar(digitos.data(), N);
+    rng.embaralhar(faixas.data(), B);
+    rng.embaralhar(pilhas.data(), B);
+
+    for (int k = 0; k < B; k++) {
+        for (int j = 0; j < B; j++) dentro[j] = j;
+        rng.embaralhar(dentro.data(), B);
+        for (int j = 0; j < B; j++) linhas[k * B + j] = faixas[k] * B + dentro[j];
+
+        for (int j = 0; j < B; j++) dentro[j] = j;
+        rng.embaralhar(dentro.data(), B);
+        for (int j = 0; j < B; j++) colunas[k * B + j] = pilhas[k] * B + dentro[j];
+    }
+
+    for (int r = 0; r < N; r++) {
+        int l = linhas[r];
+        uint16_t* destino = &celulas[static_cast<size_t>(r) * N];
+        for (int c = 0; c < N; c++) {
+            destino[c] = static_cast<uint16_t>(digitos[(B * (l % B) + l / B + colunas[c]) % N]);
+        }
+    }
+}
@@ -0,0 +1,44 @@
+#ifndef TABULEIROGRANDE_H
+#define TABULEIROGRANDE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "../Gerador/Xoshiro.h"
+
+// Tabuleiro N x N com tamanho escolhido em tempo de execução (N = B * B).
+// Para variantes grandes demais para TabuleiroN (1024x1024, 4096x4096...):
+// as células são uint16_t armazenadas linha a linha em um único vetor, e as
+// máscaras de dígitos deixam de caber em uma palavra (ver ValidadorGrande).
+class TabuleiroGrande {
+public:
+    // Constrói um tabuleiro vazio com blocos de ladoBloco x ladoBloco (2..255)
+    explicit TabuleiroGrande(int ladoBloco);
+
+    int getLadoBloco() const { return ladoBloco; }
+    int getLado() const { return lado; }
+    long long getNumCelulas() const { return static_cast<long long>(lado) * lado; }
+
+    // Método para obter o valor de uma célula
+    uint16_t get(int row, int col) const { return celulas[static_cast<size_t>(row) * lado + col]; }
+
+    // Método para colocar um valor em uma célula
+    void set(int row, int col, uint16_t value) { celulas[static_cast<size_t>(row) * lado + col] = value; }
+
+    // Ponteiro para o início de uma linha (lado células contíguas)
+    const uint16_t* linha(int row) const { return &celulas[static_cast<size_t>(row) * lado]; }
+
+    // Método para esvaziar o tabuleiro
+    void limpar();
+
+    // Método para preencher com uma solução válida aleatória: padrão canônico
+    // embaralhado por trocas de dígitos, linhas, faixas, colunas e pilhas
+    void preencherValido(Xoshiro256& rng);
+
+private:
+    int ladoBloco;
+    int lado;
+    std::vector<uint16_t> celulas;
+};
+
+#endif // TABULEIROGRANDE_H
@@ -0,0 +1,37 @@
+#include "TabuleiroN.h"
+#include <iomanip>
+#include <string>
+
+using namespace std;
+
+template <int B>
+void imprimirTabuleiroN(ostream& saida, const TabuleiroN<B>& tabuleiro) {
+    const int N = TabuleiroN<B>::LADO;
+    const int largura = N > 9 ? 3 : 2;   // valores de dois dígitos a partir de 16x16
+
+    string separador(N * largura + (B - 1) * 2, '-');
+    for (int i = 0; i < N; i++) {
+        if (i > 0 && i % B == 0) {
+            saida << separador << endl;
+        }
+        for (int j = 0; j < N; j++) {
+            if (j > 0 && j % B == 0) {
+                saida << " |";
+            }
+            int valor = tabuleiro.get(i, j);
+            if (valor == 0) {
+                saida << setw(largura) << '.';
+            } else {
+                saida << setw(largura) << valor;
+            }
+        }
+        saida << endl;
+    }
+}
+
+// Instanciações explícitas dos tamanhos suportados
+template void imprimirTabuleiroN<3>(ostream&, const TabuleiroN<3>&);
+template void imprimirTabuleiroN<4>(ostream&, const TabuleiroN<4>&);
+template void imprimirTabuleiroN<5>(ostream&, const TabuleiroN<5>&);
+template void imprimirTabuleiroN<6>(ostream&, const TabuleiroN<6>&);
+template void imprimirTabuleiroN<8>(ostream&, const TabuleiroN<8>&);
@@ -0,0 +1,94 @@
+#ifndef TABULEIRON_H
+#define TABULEIRON_H
+
+#include <cstdint>
+#include <cstring>
+#include <ostream>
+#include <type_traits>
+
+// Tipo de máscara com pelo menos 'lado' bits: cada dígito 1..lado ocupa um bit
+template <int lado>
+struct MascaraPara {
+    static_assert(lado <= 64, "lado maior que 64 não cabe em uma máscara de 64 bits");
+    typedef typename std::conditional<(lado <= 16), uint16_t,
+            typename std::conditional<(lado <= 32), uint32_t, uint64_t>::type>::type Tipo;
+};
+
+// Tabuleiro N x N (N = B * B) contíguo, armazenado linha a linha, 0 = vazio.
+// B = 3 é o Sudoku clássico (mesmo layout de Tabuleiro); B = 4, 5, 6 e 8 são as
+// variantes 16x16, 25x25, 36x36 e 64x64. Todas as dimensões são constantes de
+// compilação, então as divisões por N e por B viram multiplicações.
+template <int B>
+struct TabuleiroN {
+    static const int LADO_BLOCO = B;
+    static const int LADO = B * B;
+    static const int NUM_CELULAS = LADO * LADO;
+    static const int NUM_UNIDADES = 3 * LADO;   // linhas, colunas e blocos
+
+    typedef typename MascaraPara<LADO>::Tipo Mascara;
+
+    // Máscara com os bits de todos os dígitos 1..LADO
+    static Mascara todosDigitos() {
+        return static_cast<Mascara>(LADO == 64 ? ~static_cast<uint64_t>(0)
+                                               : (static_cast<uint64_t>(1) << LADO) - 1);
+    }
+
+    // Bit do dígito 'valor' (1..LADO); 0 para célula vazia
+    static Mascara bitDoValor(int valor) {
+        return valor ? static_cast<Mascara>(static_cast<uint64_t>(1) << (valor - 1)) : 0;
+    }
+
+    static int linhaDa(int indice) { return indice / LADO; }
+    static int colunaDa(int indice) { return indice % LADO; }
+    static int blocoDa(int indice) {
+        return (linhaDa(indice) / B) * B + colunaDa(indice) / B;
+    }
+
+    // Índice da p-ésima célula da unidade u (0..N-1 linhas, N..2N-1 colunas, 2N..3N-1 blocos)
+    static int celulaDaUnidade(int u, int p) {
+        if (u < LADO) {
+            return u * LADO + p;
+        }
+        if (u < 2 * LADO) {
+            return p * LADO + (u - LADO);
+        }
+        int bloco = u - 2 * LADO;
+        return ((bloco / B) * B + p / B) * LADO + (bloco % B) * B + p % B;
+    }
+
+    uint8_t celulas[NUM_CELULAS];
+
+    // Método para obter o valor de uma célula
+    uint8_t get(int row, int col) const { return celulas[row * LADO + col]; }
+
+    // Método para colocar um valor em uma célula
+    void set(int row, int col, uint8_t value) { celulas[row * LADO + col] = value; }
+
+    // Método para esvaziar o tabuleiro
+    void limpar() { memset(celulas, 0, sizeof(celulas)); }
+
+    // Método para retornar true se não houver nenhuma célula vazia
+    bool isComplete() const { return memchr(celulas, 0, sizeof(celulas)) == nullptr; }
+
+    // Método para contar as células preenchidas
+    int numPistas() const {
+        int n = 0;
+        for (int i = 0; i < NUM_CELULAS; i++) {
+            n += celulas[i] != 0;
+        }
+        return n;
+    }
+};
+
+// Método para imprimir um tabuleiro N x N com separadores de bloco ('.' = vazio)
+template <int B>
+void imprimirTabuleiroN(std::ostream& saida, const TabuleiroN<B>& tabuleiro);
+
+// Tamanhos instanciados em TabuleiroN.cpp e nos módulos que usam TabuleiroN
+typedef TabuleiroN<3> Tabuleiro9;
+typedef TabuleiroN<4> Tabuleiro16;
+typedef TabuleiroN<5> Tabuleiro25;
+typedef TabuleiroN<6> Tabuleiro36;
+typedef TabuleiroN<8> Tabuleiro64;
+
+#endif // TABULEIRON_H
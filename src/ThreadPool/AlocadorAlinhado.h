@@ -0,0 +1,60 @@
+#ifndef ALOCADORALINHADO_H
+#define ALOCADORALINHADO_H
+
+#include <cstddef>
+#include <new>
+#include <vector>
+
+#ifdef _WIN32
+#include <malloc.h>
+#else
+#include <stdlib.h>
+#endif
+
+// Alocador que respeita o alinhamento do tipo. Até o C++17, std::allocator
+// só garante o alinhamento de malloc (16 bytes), então um vector de structs
+// alignas(64) não fica alinhado à linha de cache e o espaçamento contra
+// falso compartilhamento deixa de valer.
+template <class T>
+struct AlocadorAlinhado {
+    typedef T value_type;
+
+    AlocadorAlinhado() {}
+    template <class U>
+    AlocadorAlinhado(const AlocadorAlinhado<U>&) {}
+
+    T* allocate(std::size_t n) {
+        std::size_t alinhamento = alignof(T) < sizeof(void*) ? sizeof(void*) : alignof(T);
+        void* p = nullptr;
+#ifdef _WIN32
+        p = _aligned_malloc(n * sizeof(T), alinhamento);
+#else
+        if (posix_memalign(&p, alinhamento, n * sizeof(T)) != 0) {
+            p = nullptr;
+        }
+#endif
+        if (!p) {
+            throw std::bad_alloc();
+        }
+        return static_cast<T*>(p);
+    }
+
+    void deallocate(T* p, std::size_t) {
+#ifdef _WIN32
+        _aligned_free(p);
+#else
+        free(p);
+#endif
+    }
+};
+
+template <class T, class U>
+bool operator==(const AlocadorAlinhado<T>&, const AlocadorAlinhado<U>&) { return true; }
+template <class T, class U>
+bool operator!=(const AlocadorAlinhado<T>&, const AlocadorAlinhado<U>&) { return false; }
+
+// Vetor de elementos alinhados (ex.: contadores por trabalhador, um por linha de cache)
+template <class T>
+using VetorAlinhado = std::vector<T, AlocadorAlinhado<T>>;
+
+#endif // ALOCADORALINHADO_H
@@ -0,0 +1,54 @@
+#ifndef DEQUEROUBO_H
+#define DEQUEROUBO_H
+
+#include <deque>
+#include <mutex>
+
+// Deque de trabalho para roubo de tarefas (work stealing).
+// O dono empilha e retira pelo fim (LIFO, dados ainda quentes na cache);
+// os outros trabalhadores roubam pelo início, ficando com os blocos mais
+// distantes do que o dono está processando. Os itens são blocos grandes de
+// trabalho, então um mutex por deque quase nunca é disputado.
+template <class T>
+class DequeRoubo {
+public:
+    // Método para o dono adicionar um item no fim
+    void empilhar(const T& item) {
+        std::lock_guard<std::mutex> lock(mtx);
+        itens.push_back(item);
+    }
+
+    // Método para o dono retirar o item mais recente. Retorna false se vazio.
+    bool retirar(T& item) {
+        std::lock_guard<std::mutex> lock(mtx);
+        if (itens.empty()) {
+            return false;
+        }
+        item = itens.back();
+        itens.pop_back();
+        return true;
+    }
+
+    // Método para outro trabalhador roubar o item mais antigo. Retorna false se vazio.
+    bool roubar(T& item) {
+        std::lock_guard<std::mutex> lock(mtx);
+        if (itens.empty()) {
+            return false;
+        }
+        item = itens.front();
+        itens.pop_front();
+        return true;
+    }
+
+    // Método para consultar se o deque está vazio (o valor pode mudar logo depois)
+    bool vazio() {
+        std::lock_guard<std::mutex> lock(mtx);
+        return itens.empty();
+    }
+
+private:
+    std::deque<T> itens;
+    std::mutex mtx;
+};
+
+#endif // DEQUEROUBO_H
@@ -0,0 +1,184 @@
+#include "ThreadPool.h"
+#include <string>
+#include "../Trace/Rastreador.h"
+
+using namespace std;
+
+// Construtor do lote
+ThreadPool::Lote::Lote(ThreadPool& pool)
+    : pool(pool), pendentes(0), totalTarefas(0), nsEmFila(0), nsExecutando(0), medirContadores(false) {}
+
+// Destrutor - nunca deixa tarefas apontando para um lote destruído
+ThreadPool::Lote::~Lote() {
+    aguardar();
+}
+
+// Registra a tarefa no lote e a coloca na fila do pool
+void ThreadPool::Lote::enviarTarefa(function<void()> funcao) {
+    {
+        lock_guard<mutex> lock(mtx);
+        pendentes++;
+        totalTarefas++;
+    }
+
+    Tarefa tarefa;
+    tarefa.funcao = std::move(funcao);
+    tarefa.lote = this;
+    tarefa.enfileiradaEm = chrono::steady_clock::now();
+    pool.enfileirar(std::move(tarefa));
+}
+
+// Chamado pela thread do pool ao terminar uma tarefa do lote
+void ThreadPool::Lote::tarefaConcluida(chrono::nanoseconds espera, chrono::nanoseconds execucao,
+                                       unsigned indiceWorker, const ContadoresHW* contadores) {
+    nsEmFila.fetch_add(espera.count());
+    nsExecutando.fetch_add(execucao.count());
+
+    lock_guard<mutex> lock(mtx);
+    if (contadores) {
+        if (porThread.size() <= indiceWorker) {
+            porThread.resize(indiceWorker + 1);
+            for (size_t i = 0; i < porThread.size(); i++) {
+                porThread[i].thread = static_cast<int>(i);
+            }
+        }
+        porThread[indiceWorker].tarefas++;
+        porThread[indiceWorker].contadores.somar(*contadores);
+    }
+    if (--pendentes == 0) {
+        cv.notify_all();
+    }
+}
+
+// Barreira de conclusão do lote
+void ThreadPool::Lote::aguardar() {
+    unique_lock<mutex> lock(mtx);
+    cv.wait(lock, [this]() { return pendentes == 0; });
+}
+
+chrono::nanoseconds ThreadPool::Lote::tempoEmFila() const {
+    return chrono::nanoseconds(nsEmFila.load());
+}
+
+chrono::nanoseconds ThreadPool::Lote::tempoExecutando() const {
+    return chrono::nanoseconds(nsExecutando.load());
+}
+
+int ThreadPool::Lote::numTarefas() const {
+    return totalTarefas;
+}
+
+ContadoresHW ThreadPool::Lote::contadores() const {
+    ContadoresHW total;
+    for (const ContadoresThread& t : porThread) {
+        total.somar(t.contadores);
+    }
+    return total;
+}
+
+// Só as threads que executaram alguma tarefa do lote
+vector<ContadoresThread> ThreadPool::Lote::contadoresPorThread() const {
+    vector<ContadoresThread> usadas;
+    for (const ContadoresThread& t : porThread) {
+        if (t.tarefas > 0) usadas.push_back(t);
+    }
+    return usadas;
+}
+
+// Construtor - cria as threads uma única vez
+ThreadPool::ThreadPool(unsigned numThreads) : encerrando(false) {
+    if (numThreads == 0) {
+        numThreads = thread::hardware_concurrency();
+        if (numThreads == 0) {
+            numThreads = 1;
+        }
+    }
+
+    for (unsigned i = 0; i < numThreads; i++) {
+        workers.emplace_back(&ThreadPool::executarWorker, this, i);
+    }
+}
+
+// Destrutor - as threads terminam as tarefas restantes antes de sair
+ThreadPool::~ThreadPool() {
+    {
+        lock_guard<mutex> lock(mtx);
+        encerrando = true;
+    }
+    cv.notify_all();
+
+    for (auto& t : workers) {
+        if (t.joinable()) t.join();
+    }
+}
+
+unsigned ThreadPool::numThreads() const {
+    return static_cast<unsigned>(workers.size());
+}
+
+// Pool compartilhado - todos os objetos Sudoku usam as mesmas threads por padrão
+shared_ptr<ThreadPool> ThreadPool::compartilhado() {
+    static shared_ptr<ThreadPool> pool = make_shared<ThreadPool>();
+    return pool;
+}
+
+void ThreadPool::enviarAvulsa(function<void()> funcao) {
+    Tarefa tarefa;
+    tarefa.funcao = std::move(funcao);
+    tarefa.lote = nullptr;
+    tarefa.enfileiradaEm = chrono::steady_clock::now();
+    enfileirar(std::move(tarefa));
+}
+
+void ThreadPool::enfileirar(Tarefa tarefa) {
+    {
+        lock_guard<mutex> lock(mtx);
+        fila.push_back(std::move(tarefa));
+    }
+    cv.notify_one();
+}
+
+// Laço das threads do pool: retira tarefas da fila e as executa
+void ThreadPool::executarWorker(unsigned indice) {
+    Rastreador::global().nomearThread("pool-" + to_string(indice));
+
+    while (true) {
+        Tarefa tarefa;
+        {
+            unique_lock<mutex> lock(mtx);
+            cv.wait(lock, [this]() { return encerrando || !fila.empty(); });
+
+            if (fila.empty()) {
+                return; // encerrando e sem trabalho pendente
+            }
+
+            tarefa = std::move(fila.front());
+            fila.pop_front();
+        }
+
+        // Contadores de hardware só quando o lote pediu: o grupo da thread é aberto uma vez
+        bool medir = tarefa.lote && tarefa.lote->medirContadores;
+        ContadoresHW contadores;
+        if (medir) GrupoContadores::daThread().iniciar();
+
+        auto inicio = chrono::steady_clock::now();
+        tarefa.funcao();
+        auto fim = chrono::steady_clock::now();
+
+        if (medir) contadores = GrupoContadores::daThread().parar();
+
+        // Linha do tempo: reaproveita os instantes já medidos, sem ler o relógio de novo
+        Rastreador& rastreador = Rastreador::global();
+        if (rastreador.ativo()) {
+            rastreador.completo("espera na fila", "pool", rastreador.ns(tarefa.enfileiradaEm), rastreador.ns(inicio));
+            rastreador.completo("tarefa", "pool", rastreador.ns(inicio), rastreador.ns(fim));
+        }
+
+        if (tarefa.lote) {
+            tarefa.lote->tarefaConcluida(
+                chrono::duration_cast<chrono::nanoseconds>(inicio - tarefa.enfileiradaEm),
+                chrono::duration_cast<chrono::nanoseconds>(fim - inicio),
+                indice, medir ? &contadores : nullptr);
+        }
+    }
+}
@@ -0,0 +1,125 @@
+#ifndef THREADPOOL_H
+#define THREADPOOL_H
+
+#include <vector>
+#include <deque>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <future>
+#include <memory>
+#include <atomic>
+#include <chrono>
+#include <type_traits>
+#include "../Perf/ContadoresHardware.h"
+
+// Pool de threads de longa duração com fila de tarefas.
+// As threads são criadas uma única vez e reaproveitadas por todas as validações,
+// evitando o custo de criar e destruir threads a cada verificação.
+class ThreadPool {
+public:
+    // Lote de tarefas enviadas ao pool. Funciona como barreira de conclusão:
+    // aguardar() só retorna quando todas as tarefas do lote terminaram.
+    // Também acumula o tempo que as tarefas passaram na fila e executando.
+    class Lote {
+    public:
+        explicit Lote(ThreadPool& pool);
+
+        // Destrutor - aguarda as tarefas pendentes do lote
+        ~Lote();
+
+        // Envia uma tarefa ao pool e retorna um futuro com o seu resultado
+        template <class F>
+        std::future<typename std::result_of<F()>::type> enviar(F funcao) {
+            typedef typename std::result_of<F()>::type Retorno;
+            auto tarefa = std::make_shared<std::packaged_task<Retorno()>>(std::move(funcao));
+            std::future<Retorno> futuro = tarefa->get_future();
+            enviarTarefa([tarefa]() { (*tarefa)(); });
+            return futuro;
+        }
+
+        // Bloqueia até que todas as tarefas enviadas neste lote terminem
+        void aguardar();
+
+        // Soma do tempo que as tarefas do lote esperaram na fila
+        std::chrono::nanoseconds tempoEmFila() const;
+
+        // Soma do tempo que as tarefas do lote passaram executando
+        std::chrono::nanoseconds tempoExecutando() const;
+
+        // Número de tarefas enviadas neste lote
+        int numTarefas() const;
+
+        // Liga a medição dos contadores de hardware em cada tarefa do lote
+        // (chamar antes de enviar as tarefas)
+        void setMedirContadores(bool ativo) { medirContadores = ativo; }
+
+        // Soma dos contadores de todas as tarefas e a soma por thread do pool
+        // (válidos depois de aguardar())
+        ContadoresHW contadores() const;
+        std::vector<ContadoresThread> contadoresPorThread() const;
+
+    private:
+        friend class ThreadPool;
+
+        ThreadPool& pool;
+        std::mutex mtx;
+        std::condition_variable cv;
+        int pendentes;
+        int totalTarefas;
+        std::atomic<long long> nsEmFila;
+        std::atomic<long long> nsExecutando;
+        bool medirContadores;
+        std::vector<ContadoresThread> porThread;   // protegido por mtx
+
+        void enviarTarefa(std::function<void()> funcao);
+        void tarefaConcluida(std::chrono::nanoseconds espera, std::chrono::nanoseconds execucao,
+                             unsigned indiceWorker, const ContadoresHW* contadores);
+
+        Lote(const Lote&) = delete;
+        Lote& operator=(const Lote&) = delete;
+    };
+
+    // Construtor - numThreads == 0 usa o número de núcleos disponíveis
+    explicit ThreadPool(unsigned numThreads = 0);
+
+    // Destrutor - esvazia a fila e finaliza as threads
+    ~ThreadPool();
+
+    // Número de threads do pool
+    unsigned numThreads() const;
+
+    // Pool compartilhado pelo processo, criado no primeiro uso
+    static std::shared_ptr<ThreadPool> compartilhado();
+
+    // Envia uma tarefa fora de qualquer lote: sem barreira nem estatísticas.
+    // Quem envia cuida de saber quando ela terminou (ex.: contador de tarefas
+    // pendentes em que a última publica o resultado), o que permite disparar
+    // trabalho de dentro de outra tarefa sem bloquear uma thread do pool.
+    void enviarAvulsa(std::function<void()> funcao);
+
+private:
+    struct Tarefa {
+        std::function<void()> funcao;
+        Lote* lote;   // nullptr para tarefas avulsas
+        std::chrono::steady_clock::time_point enfileiradaEm;
+    };
+
+    std::vector<std::thread> workers;
+    std::deque<Tarefa> fila;
+    std::mutex mtx;
+    std::condition_variable cv;
+    bool encerrando;
+
+    // Laço executado por cada thread do pool
+    void executarWorker(unsigned indice);
+
+    // Coloca uma tarefa na fila e acorda uma thread
+    void enfileirar(Tarefa tarefa);
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+};
+
+#endif // THREADPOOL_H
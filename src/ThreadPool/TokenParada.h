@@ -0,0 +1,41 @@
+#ifndef TOKENPARADA_H
+#define TOKENPARADA_H
+
+#include <atomic>
+#include <memory>
+
+// Pedido de parada compartilhado entre quem inicia um trabalho e as tarefas
+// que o executam (o equivalente ao std::stop_token do C++20 para este projeto
+// em C++11). As tarefas consultam o token entre etapas e desistem cedo; o
+// token padrão nunca pede parada.
+class TokenParada {
+public:
+    TokenParada() {}
+
+    bool paradaSolicitada() const {
+        return estado && estado->load(std::memory_order_relaxed);
+    }
+
+private:
+    friend class FonteParada;
+    explicit TokenParada(std::shared_ptr<std::atomic<bool> > estado) : estado(estado) {}
+
+    std::shared_ptr<std::atomic<bool> > estado;
+};
+
+// Origem dos tokens: solicitarParada() vale para todos os tokens já entregues
+class FonteParada {
+public:
+    FonteParada() : estado(std::make_shared<std::atomic<bool> >(false)) {}
+
+    TokenParada token() const { return TokenParada(estado); }
+
+    void solicitarParada() { estado->store(true, std::memory_order_relaxed); }
+
+    bool paradaSolicitada() const { return estado->load(std::memory_order_relaxed); }
+
+private:
+    std::shared_ptr<std::atomic<bool> > estado;
+};
+
+#endif // TOKENPARADA_H
@@ -0,0 +1,29 @@
+#ifndef ESCAPARJSON_H
+#define ESCAPARJSON_H
+
+#include <string>
+
+// Escapa um texto para uma string JSON: aspas, barra invertida e os
+// caracteres de controle (< 0x20), estes como \u00XX. Usado pelo rastreador
+// (nomes de eventos e threads) e pela saída JSON dos benchmarks.
+inline std::string escaparJSON(const std::string& texto) {
+    static const char HEX[] = "0123456789abcdef";
+    std::string saida;
+    saida.reserve(texto.size());
+    for (char c : texto) {
+        unsigned char u = static_cast<unsigned char>(c);
+        if (c == '"' || c == '\\') {
+            saida += '\\';
+            saida += c;
+        } else if (u < 0x20) {
+            saida += "\\u00";
+            saida += HEX[u >> 4];
+            saida += HEX[u & 0x0F];
+        } else {
+            saida += c;
+        }
+    }
+    return saida;
+}
+
+#endif // ESCAPARJSON_H
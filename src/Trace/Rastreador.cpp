@@ -0,0 +1,90 @@
+#include "Rastreador.h"
+#include "EscaparJSON.h"
+#include <fstream>
+#include <iomanip>
+
+using namespace std;
+
+// Rastreador do processo, criado no primeiro uso (desligado)
+Rastreador& Rastreador::global() {
+    static Rastreador rastreador;
+    return rastreador;
+}
+
+// Construtor - a origem da linha do tempo é o momento da criação
+Rastreador::Rastreador() : ligado(false), origem(chrono::steady_clock::now()) {}
+
+Rastreador::BufferThread& Rastreador::bufferDaThread() {
+    thread_local BufferThread* buffer = nullptr;
+    if (!buffer) {
+        lock_guard<mutex> lock(mtx);
+        buffers.emplace_back(new BufferThread());
+        buffer = buffers.back().get();
+        buffer->tid = static_cast<int>(buffers.size());
+        buffer->eventos.reserve(1024);
+    }
+    return *buffer;
+}
+
+void Rastreador::completo(const char* nome, const char* categoria, int64_t inicioNs, int64_t fimNs) {
+    Evento e = { nome, categoria, inicioNs, fimNs - inicioNs };
+    bufferDaThread().eventos.push_back(e);
+}
+
+void Rastreador::instante(const char* nome, const char* categoria) {
+    if (!ativo()) return;
+    Evento e = { nome, categoria, agora(), -1 };
+    bufferDaThread().eventos.push_back(e);
+}
+
+void Rastreador::nomearThread(const string& nome) {
+    bufferDaThread().nome = nome;
+}
+
+void Rastreador::exportarJSON(ostream& saida) const {
+    lock_guard<mutex> lock(mtx);
+
+    saida << "{\"displayTimeUnit\": \"ns\", \"traceEvents\": [";
+    bool primeiro = true;
+    auto separar = [&]() {
+        saida << (primeiro ? "\n" : ",\n");
+        primeiro = false;
+    };
+
+    saida << fixed << setprecision(3);
+    for (const unique_ptr<BufferThread>& b : buffers) {
+        if (!b->nome.empty()) {
+            separar();
+            saida << "{\"name\": \"thread_name\", \"ph\": \"M\", \"pid\": 1, \"tid\": " << b->tid
+                  << ", \"args\": {\"name\": \"" << escaparJSON(b->nome) << "\"}}";
+        }
+        // ts e dur em microssegundos, com precisão de nanossegundos
+        for (const Evento& e : b->eventos) {
+            separar();
+            saida << "{\"name\": \"" << escaparJSON(e.nome) << "\", \"cat\": \"" << escaparJSON(e.categoria)
+                  << "\", \"pid\": 1, \"tid\": " << b->tid << ", \"ts\": " << e.inicioNs / 1000.0;
+            if (e.duracaoNs >= 0) {
+                saida << ", \"ph\": \"X\", \"dur\": " << e.duracaoNs / 1000.0 << "}";
+            } else {
+                saida << ", \"ph\": \"i\", \"s\": \"t\"}";
+            }
+        }
+    }
+    saida << "\n]}\n";
+}
+
+bool Rastreador::salvar(const string& arquivo) const {
+    ofstream saida(arquivo.c_str());
+    if (!saida) {
+        return false;
+    }
+    exportarJSON(saida);
+    return static_cast<bool>(saida);
+}
+
+void Rastreador::limpar() {
+    lock_guard<mutex> lock(mtx);
+    for (const unique_ptr<BufferThread>& b : buffers) {
+        b->eventos.clear();
+    }
+}
@@ -0,0 +1,118 @@
+#ifndef RASTREADOR_H
+#define RASTREADOR_H
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
+
+// Marcação de um trecho com o nome e a categoria (literais). Desligado, o
+// custo é uma leitura atômica relaxada; com RASTREIO_DESLIGADO definido na
+// compilação, as macros somem.
+#ifdef RASTREIO_DESLIGADO
+#define RASTREAR(nome, categoria) do {} while (0)
+#define RASTREAR_INSTANTE(nome, categoria) do {} while (0)
+#else
+#define RASTREIO_CONCAT2(a, b) a##b
+#define RASTREIO_CONCAT(a, b) RASTREIO_CONCAT2(a, b)
+#define RASTREAR(nome, categoria) SpanRastreio RASTREIO_CONCAT(spanRastreio_, __LINE__)(nome, categoria)
+#define RASTREAR_INSTANTE(nome, categoria) Rastreador::global().instante(nome, categoria)
+#endif
+
+// Linha do tempo no formato trace_event do Chrome (abre no Perfetto e em
+// chrome://tracing). Cada thread grava seus eventos em um buffer próprio, sem
+// trava; os buffers pertencem ao rastreador e sobrevivem ao fim da thread.
+// Os tempos vêm do steady_clock, relativos à criação do rastreador.
+// exportarJSON() deve ser chamado quando nenhuma thread estiver gravando
+// (depois das validações terminarem).
+class Rastreador {
+public:
+    // Rastreador do processo, criado no primeiro uso (desligado)
+    static Rastreador& global();
+
+    void ativar() { ligado.store(true, std::memory_order_relaxed); }
+    void desativar() { ligado.store(false, std::memory_order_relaxed); }
+    bool ativo() const { return ligado.load(std::memory_order_relaxed); }
+
+    // Nanossegundos desde a criação do rastreador
+    int64_t agora() const {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - origem).count();
+    }
+
+    // Converte um instante do steady_clock para a escala da linha do tempo
+    int64_t ns(std::chrono::steady_clock::time_point instante) const {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(instante - origem).count();
+    }
+
+    // Grava um trecho completo (fase "X") na thread chamadora
+    void completo(const char* nome, const char* categoria, int64_t inicioNs, int64_t fimNs);
+
+    // Grava um evento instantâneo (fase "i") na thread chamadora
+    void instante(const char* nome, const char* categoria);
+
+    // Dá nome à thread chamadora na linha do tempo (ex.: "pool-0")
+    void nomearThread(const std::string& nome);
+
+    // Escreve todos os eventos como JSON trace_event
+    void exportarJSON(std::ostream& saida) const;
+
+    // Escreve o JSON em um arquivo; retorna false se não conseguiu abrir
+    bool salvar(const std::string& arquivo) const;
+
+    // Descarta os eventos gravados até agora
+    void limpar();
+
+private:
+    struct Evento {
+        const char* nome;
+        const char* categoria;
+        int64_t inicioNs;
+        int64_t duracaoNs;   // -1 para eventos instantâneos
+    };
+
+    struct BufferThread {
+        int tid;
+        std::string nome;
+        std::vector<Evento> eventos;
+    };
+
+    Rastreador();
+
+    std::atomic<bool> ligado;
+    std::chrono::steady_clock::time_point origem;
+    mutable std::mutex mtx;                              // protege a lista de buffers
+    std::vector<std::unique_ptr<BufferThread> > buffers;
+
+    // Buffer da thread chamadora, registrado no primeiro uso
+    BufferThread& bufferDaThread();
+};
+
+// Trecho medido do construtor ao destrutor (use a macro RASTREAR)
+class SpanRastreio {
+public:
+    SpanRastreio(const char* nome, const char* categoria)
+        : nome(nome), categoria(categoria),
+          inicioNs(Rastreador::global().ativo() ? Rastreador::global().agora() : -1) {}
+
+    ~SpanRastreio() {
+        if (inicioNs >= 0) {
+            Rastreador& r = Rastreador::global();
+            r.completo(nome, categoria, inicioNs, r.agora());
+        }
+    }
+
+private:
+    const char* nome;
+    const char* categoria;
+    int64_t inicioNs;
+
+    SpanRastreio(const SpanRastreio&) = delete;
+    SpanRastreio& operator=(const SpanRastreio&) = delete;
+};
+
+#endif // RASTREADOR_H
@@ -0,0 +1,28 @@
+#ifndef VALIDACAOSTATS_H
+#define VALIDACAOSTATS_H
+
+#include <chrono>
+#include <ctime>
+#include <vector>
+#include "../Perf/ContadoresHardware.h"
+
+// Struct para armazenar estatísticas de validação
+struct ValidacaoStats {
+    std::chrono::milliseconds tempoExecucao;
+    std::chrono::nanoseconds tempoEmNs;
+    std::clock_t cpuTicks;
+    long long numCelulasVerificadas;     // long long: lotes grandes passam de 2^31 células
+    long long numConflitosEncontrados;
+    int numThreadsUsadas;
+    int numTarefas;                          // tarefas enviadas ao pool
+    std::chrono::nanoseconds tempoEmFila;    // soma do tempo das tarefas aguardando na fila
+    std::chrono::nanoseconds tempoTarefas;   // soma do tempo das tarefas executando
+
+    // Contadores de hardware (perf_event_open), preenchidos só quando pedidos.
+    // Eventos indisponíveis ficam com -1.
+    bool contadoresMedidos = false;
+    ContadoresHW contadores;                           // soma de todas as threads
+    std::vector<ContadoresThread> contadoresPorThread;
+};
+
+#endif // VALIDACAOSTATS_H
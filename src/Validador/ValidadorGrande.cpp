@@ -0,0 +1,331 @@
+#include "ValidadorGrande.h"
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <ctime>
+#include <vector>
+
+using namespace std;
+
+namespace {
+
+// Marca o dígito (índice 0..N-1) na máscara 'vistos'; se já estava, marca em 'dup'
+inline void marcar(uint64_t* vistos, uint64_t* dup, int indice) {
+    int palavra = indice >> 6;
+    uint64_t bit = 1ULL << (indice & 63);
+    dup[palavra] |= vistos[palavra] & bit;
+    vistos[palavra] |= bit;
+}
+
+inline bool algumBit(const uint64_t* mascaras, size_t numPalavras) {
+    uint64_t qualquer = 0;
+    for (size_t i = 0; i < numPalavras; i++) {
+        qualquer |= mascaras[i];
+    }
+    return qualquer != 0;
+}
+
+// Máscaras de duplicados das 3N unidades, cada uma com 'palavras' palavras
+struct Duplicados {
+    int palavras;
+    vector<uint64_t> linhas, colunas, blocos;
+
+    // Uma flag por unidade com algum duplicado: a contagem de conflitos só
+    // consulta as máscaras (2MB de colunas no 4096x4096) quando a flag indica
+    vector<uint8_t> linhaTemDup, colunaTemDup, blocoTemDup;
+
+    Duplicados(int lado, int palavras)
+        : palavras(palavras),
+          linhas(static_cast<size_t>(lado) * palavras, 0),
+          colunas(static_cast<size_t>(lado) * palavras, 0),
+          blocos(static_cast<size_t>(lado) * palavras, 0) {}
+
+    // Método para montar as flags; retorna true se alguma unidade tem duplicado
+    bool montarFlags(int lado) {
+        const vector<uint64_t>* mascaras[3] = { &linhas, &colunas, &blocos };
+        vector<uint8_t>* flags[3] = { &linhaTemDup, &colunaTemDup, &blocoTemDup };
+        bool algum = false;
+        for (int k = 0; k < 3; k++) {
+            flags[k]->assign(lado, 0);
+            for (int u = 0; u < lado; u++) {
+                bool tem = algumBit(&(*mascaras[k])[static_cast<size_t>(u) * palavras], palavras);
+                (*flags[k])[u] = tem;
+                algum = algum || tem;
+            }
+        }
+        return algum;
+    }
+};
+
+// Célula em conflito: seu dígito está no duplicado da linha, da coluna ou do bloco
+inline bool emConflito(const Duplicados& d, int r, int c, int bloco, int v) {
+    const int P = d.palavras;
+    int palavra = (v - 1) >> 6;
+    uint64_t bit = 1ULL << ((v - 1) & 63);
+    uint64_t rep = d.linhas[static_cast<size_t>(r) * P + palavra] |
+                   d.colunas[static_cast<size_t>(c) * P + palavra] |
+                   d.blocos[static_cast<size_t>(bloco) * P + palavra];
+    return (rep & bit) != 0;
+}
+
+// Conta as células em conflito das unidades de índice [inicio, fim) de cada tipo.
+// Só as unidades com duplicado são visitadas, e cada célula é contada uma vez:
+// pela linha se a linha tem duplicado; senão pela coluna; senão pelo bloco.
+long long contarConflitos(const TabuleiroGrande& t, const Duplicados& d, int inicio, int fim) {
+    const int N = t.getLado();
+    const int B = t.getLadoBloco();
+    long long conflitos = 0;
+
+    for (int r = inicio; r < fim; r++) {
+        if (!d.linhaTemDup[r]) continue;
+        const uint16_t* lin = t.linha(r);
+        for (int c = 0; c < N; c++) {
+            if (lin[c]) conflitos += emConflito(d, r, c, (r / B) * B + c / B, lin[c]);
+        }
+    }
+
+    for (int c = inicio; c < fim; c++) {
+        if (!d.colunaTemDup[c]) continue;
+        for (int r = 0; r < N; r++) {
+            int v = t.get(r, c);
+            if (v && !d.linhaTemDup[r]) conflitos += emConflito(d, r, c, (r / B) * B + c / B, v);
+        }
+    }
+
+    for (int b = inicio; b < fim; b++) {
+        if (!d.blocoTemDup[b]) continue;
+        int r0 = (b / B) * B;
+        int c0 = (b % B) * B;
+        for (int r = r0; r < r0 + B; r++) {
+            if (d.linhaTemDup[r]) continue;
+            for (int c = c0; c < c0 + B; c++) {
+                int v = t.get(r, c);
+                if (v && !d.colunaTemDup[c]) conflitos += emConflito(d, r, c, b, v);
+            }
+        }
+    }
+    return conflitos;
+}
+
+ResultadoMascara montarResultado(long long conflitos, long long vazias) {
+    ResultadoMascara r;
+    r.numConflitos = static_cast<int>(min<long long>(conflitos, 0x7FFFFFFF));
+    r.numVazias = static_cast<int>(min<long long>(vazias, 0x7FFFFFFF));
+    if (conflitos > 0) {
+        r.resultado = ResultadoValidacao::INVALIDO;
+    } else if (vazias > 0) {
+        r.resultado = ResultadoValidacao::INCOMPLETO;
+    } else {
+        r.resultado = ResultadoValidacao::VALIDO;
+    }
+    return r;
+}
+
+} // namespace
+
+// Construtor
+ValidadorGrande::ValidadorGrande(shared_ptr<ThreadPool> pool)
+    : pool(pool), numTrabalhadores(0), alturaTile(0), larguraFaixa(0) {
+    ultimasStats.tempoExecucao = chrono::milliseconds(0);
+    ultimasStats.tempoEmNs = chrono::nanoseconds(0);
+    ultimasStats.cpuTicks = 0;
+    ultimasStats.numCelulasVerificadas = 0;
+    ultimasStats.numConflitosEncontrados = 0;
+    ultimasStats.numThreadsUsadas = 0;
+    ultimasStats.numTarefas = 0;
+    ultimasStats.tempoEmFila = chrono::nanoseconds(0);
+    ultimasStats.tempoTarefas = chrono::nanoseconds(0);
+}
+
+void ValidadorGrande::setNumTrabalhadores(int n) {
+    numTrabalhadores = max(0, n);
+}
+
+void ValidadorGrande::setAlturaTile(int linhas) {
+    alturaTile = max(0, linhas);
+}
+
+void ValidadorGrande::setLarguraFaixa(int colunas) {
+    larguraFaixa = max(0, colunas);
+}
+
+ResultadoMascara ValidadorGrande::validar(const TabuleiroGrande& t) {
+    auto inicio = chrono::high_resolution_clock::now();
+    std::clock_t inicioCpu = std::clock();
+
+    const int N = t.getLado();
+    const int B = t.getLadoBloco();
+    const int P = (N + 63) / 64;
+
+    // Ladrilho: múltiplo do lado do bloco, para que cada bloco caia em um único ladrilho
+    int altura = alturaTile > 0 ? ((alturaTile + B - 1) / B) * B : B;
+    // Faixa: máscaras vistos + duplicados das colunas da faixa em ~32KB
+    int largura = larguraFaixa > 0 ? larguraFaixa : max(1, 32768 / (16 * P));
+    largura = min(largura, N);
+
+    int numFaixasBloco = B;   // N / B linhas de blocos
+    int trabalhadores = numTrabalhadores > 0 ? numTrabalhadores : static_cast<int>(pool->numThreads());
+    trabalhadores = max(1, min(trabalhadores, numFaixasBloco));
+
+    Duplicados dup(N, P);
+    vector<vector<uint64_t>> vistosColuna(trabalhadores), dupColuna(trabalhadores);
+    vector<long long> conflitos(trabalhadores, 0), vazias(trabalhadores, 0);
+
+    ThreadPool::Lote lote(*pool);
+
+    // Passo 1: linhas e blocos completos, colunas parciais por trabalhador
+    for (int w = 0; w < trabalhadores; w++) {
+        lote.enviar([&, w]() {
+            int primeiraLinha = numFaixasBloco * w / trabalhadores * B;
+            int ultimaLinha = numFaixasBloco * (w + 1) / trabalhadores * B;
+
+            vector<uint64_t>& vistosCol = vistosColuna[w];
+            vector<uint64_t>& dupCol = dupColuna[w];
+            vistosCol.assign(static_cast<size_t>(N) * P, 0);
+            dupCol.assign(static_cast<size_t>(N) * P, 0);
+
+            vector<uint64_t> vistosLinha(static_cast<size_t>(altura) * P);
+            long long vaziasLocal = 0;
+            vector<uint64_t> vistosBloco(static_cast<size_t>(altura / B) * B * P);
+
+            for (int topo = primeiraLinha; topo < ultimaLinha; topo += altura) {
+                int base = min(topo + altura, ultimaLinha);
+                fill(vistosLinha.begin(), vistosLinha.end(), 0);
+                fill(vistosBloco.begin(), vistosBloco.end(), 0);
+
+                for (int c0 = 0; c0 < N; c0 += largura) {
+                    int c1 = min(c0 + largura, N);
+                    for (int r = topo; r < base; r++) {
+                        const uint16_t* lin = t.linha(r);
+                        uint64_t* vl = &vistosLinha[static_cast<size_t>(r - topo) * P];
+                        uint64_t* dl = &dup.linhas[static_cast<size_t>(r) * P];
+                        int faixaBloco = (r - topo) / B;
+                        for (int c = c0; c < c1; c++) {
+                            int v = lin[c];
+                            if (v == 0) {
+                                vaziasLocal++;
+                                continue;
+                            }
+                            int indice = v - 1;
+                            marcar(vl, dl, indice);
+                            marcar(&vistosCol[static_cast<size_t>(c) * P], &dupCol[static_cast<size_t>(c) * P], indice);
+                            int blocoLocal = faixaBloco * B + c / B;
+                            int blocoGlobal = (r / B) * B + c / B;
+                            marcar(&vistosBloco[static_cast<size_t>(blocoLocal) * P],
+                                   &dup.blocos[static_cast<size_t>(blocoGlobal) * P], indice);
+                        }
+                    }
+                }
+            }
+            vazias[w] = vaziasLocal;
+        });
+    }
+    lote.aguardar();
+
+    // Passo 2: combinar as máscaras parciais de coluna, dividindo as colunas
+    for (int w = 0; w < trabalhadores; w++) {
+        lote.enviar([&, w]() {
+            size_t ini = static_cast<size_t>(N) * w / trabalhadores * P;
+            size_t fim = static_cast<size_t>(N) * (w + 1) / trabalhadores * P;
+            for (size_t i = ini; i < fim; i++) {
+                uint64_t vistos = 0;
+                uint64_t d = 0;
+                for (int k = 0; k < trabalhadores; k++) {
+                    d |= dupColuna[k][i] | (vistos & vistosColuna[k][i]);
+                    vistos |= vistosColuna[k][i];
+                }
+                dup.colunas[i] = d;
+            }
+        });
+    }
+    lote.aguardar();
+
+    // Passo 3: contar conflitos, só nas unidades com algum duplicado
+    if (dup.montarFlags(N)) {
+        for (int w = 0; w < trabalhadores; w++) {
+            lote.enviar([&, w]() {
+                conflitos[w] = contarConflitos(t, dup, N * w / trabalhadores, N * (w + 1) / trabalhadores);
+            });
+        }
+        lote.aguardar();
+    }
+
+    long long totalConflitos = 0;
+    long long totalVazias = 0;
+    for (int w = 0; w < trabalhadores; w++) {
+        totalConflitos += conflitos[w];
+        totalVazias += vazias[w];
+    }
+
+    auto fim = chrono::high_resolution_clock::now();
+    ultimasStats.tempoExecucao           = chrono::duration_cast<chrono::milliseconds>(fim - inicio);
+    ultimasStats.tempoEmNs               = chrono::duration_cast<chrono::nanoseconds>(fim - inicio);
+    ultimasStats.cpuTicks                = std::clock() - inicioCpu;
+    ultimasStats.numCelulasVerificadas   = t.getNumCelulas() * 3;
+    ultimasStats.numConflitosEncontrados = totalConflitos;
+    ultimasStats.numThreadsUsadas        = min<int>(trabalhadores, pool->numThreads());
+    ultimasStats.numTarefas              = lote.numTarefas();
+    ultimasStats.tempoEmFila             = lote.tempoEmFila();
+    ultimasStats.tempoTarefas            = lote.tempoExecutando();
+    return montarResultado(totalConflitos, totalVazias);
+}
+
+ResultadoMascara ValidadorGrande::validarUmaUnidadePorTarefa(const TabuleiroGrande& t) {
+    auto inicio = chrono::high_resolution_clock::now();
+    std::clock_t inicioCpu = std::clock();
+
+    const int N = t.getLado();
+    const int B = t.getLadoBloco();
+    const int P = (N + 63) / 64;
+
+    Duplicados dup(N, P);
+    ThreadPool::Lote lote(*pool);
+
+    // Uma tarefa por unidade, como iniciarValidacaoParalelaDetalhada
+    for (int u = 0; u < 3 * N; u++) {
+        lote.enviar([&, u]() {
+            vector<uint64_t> vistos(P, 0);
+            int k = u % N;
+            if (u < N) {
+                const uint16_t* lin = t.linha(k);
+                for (int c = 0; c < N; c++) {
+                    if (lin[c]) marcar(vistos.data(), &dup.linhas[static_cast<size_t>(k) * P], lin[c] - 1);
+                }
+            } else if (u < 2 * N) {
+                for (int r = 0; r < N; r++) {
+                    int v = t.get(r, k);
+                    if (v) marcar(vistos.data(), &dup.colunas[static_cast<size_t>(k) * P], v - 1);
+                }
+            } else {
+                int r0 = (k / B) * B;
+                int c0 = (k % B) * B;
+                for (int r = r0; r < r0 + B; r++) {
+                    for (int c = c0; c < c0 + B; c++) {
+                        int v = t.get(r, c);
+                        if (v) marcar(vistos.data(), &dup.blocos[static_cast<size_t>(k) * P], v - 1);
+                    }
+                }
+            }
+        });
+    }
+    lote.aguardar();
+
+    long long conflitos = dup.montarFlags(N) ? contarConflitos(t, dup, 0, N) : 0;
+    long long vazias = 0;
+    for (int r = 0; r < N; r++) {
+        const uint16_t* lin = t.linha(r);
+        vazias += count(lin, lin + N, 0);
+    }
+
+    auto fim = chrono::high_resolution_clock::now();
+    ultimasStats.tempoExecucao           = chrono::duration_cast<chrono::milliseconds>(fim - inicio);
+    ultimasStats.tempoEmNs               = chrono::duration_cast<chrono::nanoseconds>(fim - inicio);
+    ultimasStats.cpuTicks                = std::clock() - inicioCpu;
+    ultimasStats.numCelulasVerificadas   = t.getNumCelulas() * 3;
+    ultimasStats.numConflitosEncontrados = conflitos;
+    ultimasStats.numThreadsUsadas        = min<int>(lote.numTarefas(), pool->numThreads());
+    ultimasStats.numTarefas              = lote.numTarefas();
+    ultimasStats.tempoEmFila             = lote.tempoEmFila();
+    ultimasStats.tempoTarefas            = lote.tempoExecutando();
+    return montarResultado(conflitos, vazias);
+}
@@ -0,0 +1,48 @@
+#ifndef VALIDADORGRANDE_H
+#define VALIDADORGRANDE_H
+
+#include <memory>
+#include "../Tabuleiro/TabuleiroGrande.h"
+#include "../ThreadPool/ThreadPool.h"
+#include "ValidadorMascara.h"
+#include "ValidacaoStats.h"
+
+// Validador paralelo para tabuleiros grandes (TabuleiroGrande).
+// Cada unidade tem uma máscara de N bits em ceil(N/64) palavras. Cada trabalhador
+// recebe uma faixa contígua de linhas de blocos e a percorre em ladrilhos: um
+// ladrilho tem 'alturaTile' linhas e é lido em faixas de 'larguraFaixa' colunas,
+// de modo que as máscaras parciais das colunas da faixa, das linhas do ladrilho
+// e dos blocos do ladrilho fiquem na cache. Linhas e blocos terminam dentro da
+// faixa do trabalhador; as máscaras parciais de coluna de cada trabalhador são
+// combinadas no fim (duplicado = dupA | dupB | (vistosA & vistosB)).
+class ValidadorGrande {
+public:
+    explicit ValidadorGrande(std::shared_ptr<ThreadPool> pool = ThreadPool::compartilhado());
+
+    // Número de trabalhadores (0 = threads do pool). Nunca passa do número de faixas de blocos.
+    void setNumTrabalhadores(int numTrabalhadores);
+
+    // Linhas por ladrilho, arredondadas para múltiplo do lado do bloco (0 = um bloco de altura)
+    void setAlturaTile(int linhas);
+
+    // Colunas lidas por vez dentro do ladrilho (0 = o que cabe em ~32KB de máscaras)
+    void setLarguraFaixa(int colunas);
+
+    // Validação ladrilhada descrita acima
+    ResultadoMascara validar(const TabuleiroGrande& tabuleiro);
+
+    // Referência: uma tarefa por unidade, colunas percorridas com passo de uma linha inteira
+    ResultadoMascara validarUmaUnidadePorTarefa(const TabuleiroGrande& tabuleiro);
+
+    // Estatísticas da última validação
+    const ValidacaoStats& getUltimasStats() const { return ultimasStats; }
+
+private:
+    std::shared_ptr<ThreadPool> pool;
+    int numTrabalhadores;
+    int alturaTile;
+    int larguraFaixa;
+    ValidacaoStats ultimasStats;
+};
+
+#endif // VALIDADORGRANDE_H
@@ -0,0 +1,131 @@
+#include "ValidadorLote.h"
+#include "ValidadorSoA.h"
+#include "../ThreadPool/AlocadorAlinhado.h"
+#include "../ThreadPool/DequeRoubo.h"
+#include <algorithm>
+#include <vector>
+
+using namespace std;
+
+namespace {
+
+// Faixa [inicio, fim) de índices de tabuleiros
+struct Bloco {
+    size_t inicio;
+    size_t fim;
+};
+
+// Contadores de um trabalhador, cada um na sua linha de cache
+struct alignas(64) ContagemTrabalhador {
+    long long validos;
+    long long invalidos;
+    long long incompletos;
+    long long conflitos;
+    long long roubados;
+};
+
+} // namespace
+
+// Construtor
+ValidadorLote::ValidadorLote(shared_ptr<ThreadPool> pool, int tamanhoBloco)
+    : pool(pool), tamanhoBloco(tamanhoBloco > 0 ? tamanhoBloco : 1) {
+    ultimasStats.tempoExecucao = chrono::milliseconds(0);
+    ultimasStats.tempoEmNs = chrono::nanoseconds(0);
+    ultimasStats.cpuTicks = 0;
+    ultimasStats.numCelulasVerificadas = 0;
+    ultimasStats.numConflitosEncontrados = 0;
+    ultimasStats.numThreadsUsadas = 0;
+    ultimasStats.numTarefas = 0;
+    ultimasStats.tempoEmFila = chrono::nanoseconds(0);
+    ultimasStats.tempoTarefas = chrono::nanoseconds(0);
+}
+
+ResumoLote ValidadorLote::validar(const Tabuleiro* tabuleiros, size_t quantidade,
+                                  ResultadoValidacao* resultados) {
+    auto inicio = chrono::high_resolution_clock::now();
+    std::clock_t inicioCpu = std::clock();
+
+    size_t numBlocos = (quantidade + tamanhoBloco - 1) / tamanhoBloco;
+    unsigned numTrabalhadores = static_cast<unsigned>(
+        min<size_t>(pool->numThreads(), max<size_t>(numBlocos, 1)));
+
+    // Cada trabalhador começa com uma faixa contígua de blocos. Empilhados do
+    // último para o primeiro, o dono os retira em ordem crescente de endereço.
+    vector<DequeRoubo<Bloco>> deques(numTrabalhadores);
+    for (unsigned w = 0; w < numTrabalhadores; w++) {
+        size_t primeiro = numBlocos * w / numTrabalhadores;
+        size_t ultimo = numBlocos * (w + 1) / numTrabalhadores;
+        for (size_t b = ultimo; b > primeiro; b--) {
+            Bloco bloco;
+            bloco.inicio = (b - 1) * tamanhoBloco;
+            bloco.fim = min(quantidade, b * tamanhoBloco);
+            deques[w].empilhar(bloco);
+        }
+    }
+
+    VetorAlinhado<ContagemTrabalhador> contagens(numTrabalhadores);   // alocador respeita o alignas(64)
+    {
+        ThreadPool::Lote lote(*pool);
+        for (unsigned w = 0; w < numTrabalhadores; w++) {
+            lote.enviar([&, w]() {
+                ContagemTrabalhador c = {0, 0, 0, 0, 0};
+                vector<ResultadoMascara> buffer(tamanhoBloco);
+                Bloco bloco;
+                while (true) {
+                    bool obtido = deques[w].retirar(bloco);
+
+                    // Deque próprio vazio: tentar roubar dos vizinhos, em ordem circular.
+                    // Nenhum bloco é criado depois do início, então se todos estão
+                    // vazios o trabalho acabou.
+                    for (unsigned k = 1; !obtido && k < numTrabalhadores; k++) {
+                        obtido = deques[(w + k) % numTrabalhadores].roubar(bloco);
+                        if (obtido) {
+                            c.roubados++;
+                        }
+                    }
+                    if (!obtido) {
+                        break;
+                    }
+
+                    size_t tamanho = bloco.fim - bloco.inicio;
+                    validarLoteSoA(tabuleiros + bloco.inicio, tamanho, buffer.data());
+                    for (size_t k = 0; k < tamanho; k++) {
+                        const ResultadoMascara& r = buffer[k];
+                        resultados[bloco.inicio + k] = r.resultado;
+                        c.conflitos += r.numConflitos;
+                        switch (r.resultado) {
+                            case ResultadoValidacao::VALIDO:     c.validos++; break;
+                            case ResultadoValidacao::INVALIDO:   c.invalidos++; break;
+                            case ResultadoValidacao::INCOMPLETO: c.incompletos++; break;
+                        }
+                    }
+                }
+                contagens[w] = c;
+            });
+        }
+        lote.aguardar();
+
+        ultimasStats.numTarefas   = lote.numTarefas();
+        ultimasStats.tempoEmFila  = lote.tempoEmFila();
+        ultimasStats.tempoTarefas = lote.tempoExecutando();
+    }
+
+    ResumoLote resumo = {0, 0, 0, 0};
+    long long conflitos = 0;
+    for (const ContagemTrabalhador& c : contagens) {
+        resumo.validos += c.validos;
+        resumo.invalidos += c.invalidos;
+        resumo.incompletos += c.incompletos;
+        resumo.blocosRoubados += c.roubados;
+        conflitos += c.conflitos;
+    }
+
+    auto fim = chrono::high_resolution_clock::now();
+    ultimasStats.tempoExecucao           = chrono::duration_cast<chrono::milliseconds>(fim - inicio);
+    ultimasStats.tempoEmNs               = chrono::duration_cast<chrono::nanoseconds>(fim - inicio);
+    ultimasStats.cpuTicks                = std::clock() - inicioCpu;
+    ultimasStats.numThreadsUsadas        = static_cast<int>(numTrabalhadores);
+    ultimasStats.numCelulasVerificadas   = static_cast<long long>(quantidade) * 81;
+    ultimasStats.numConflitosEncontrados = conflitos;
+    return resumo;
+}
@@ -0,0 +1,42 @@
+#ifndef VALIDADORLOTE_H
+#define VALIDADORLOTE_H
+
+#include <cstddef>
+#include <memory>
+#include "../Tabuleiro/Tabuleiro.h"
+#include "../ThreadPool/ThreadPool.h"
+#include "ValidadorMascara.h"
+#include "ValidacaoStats.h"
+
+// Contagem dos resultados de uma validação em lote
+struct ResumoLote {
+    long long validos;
+    long long invalidos;
+    long long incompletos;
+    long long blocosRoubados;   // blocos executados por um trabalhador que não era o dono
+};
+
+// Validador de grandes coleções de tabuleiros.
+// O vetor é dividido em blocos de 'tamanhoBloco' tabuleiros, distribuídos em
+// faixas contíguas pelos deques dos trabalhadores; quem esvazia o próprio
+// deque rouba blocos dos outros, equilibrando a carga mesmo quando uma thread
+// atrasa. Cada bloco é validado 32 tabuleiros por vez pelo kernel SoA.
+class ValidadorLote {
+public:
+    explicit ValidadorLote(std::shared_ptr<ThreadPool> pool = ThreadPool::compartilhado(),
+                           int tamanhoBloco = 1024);
+
+    // Valida 'quantidade' tabuleiros e escreve o resultado de cada um em
+    // 'resultados' (que deve ter espaço para 'quantidade' itens)
+    ResumoLote validar(const Tabuleiro* tabuleiros, size_t quantidade, ResultadoValidacao* resultados);
+
+    // Estatísticas agregadas da última chamada a validar()
+    const ValidacaoStats& getUltimasStats() const { return ultimasStats; }
+
+private:
+    std::shared_ptr<ThreadPool> pool;
+    int tamanhoBloco;
+    ValidacaoStats ultimasStats;
+};
+
+#endif // VALIDADORLOTE_H
@@ -0,0 +1,212 @@
+#include "ValidadorMascara.h"
+#include "../Tabuleiro/Tabuleiro.h"
+#include <cstring>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define VALIDADOR_MASCARA_X86 1
+#include <immintrin.h>
+#endif
+
+using namespace std;
+
+namespace {
+
+// Valor 1-9 vira o bit (valor - 1); célula vazia não ocupa bit
+inline uint16_t bitDoValor(uint8_t valor) {
+    return valor ? static_cast<uint16_t>(1u << (valor - 1)) : 0;
+}
+
+// Conta vazias e células em conflito a partir das máscaras de duplicados de cada unidade
+ResultadoMascara finalizar(const uint8_t* celulas, const uint16_t duplicados[27], bool algumDuplicado) {
+    ResultadoMascara r;
+    r.numConflitos = 0;
+    r.numVazias = 0;
+
+    for (int i = 0; i < 81; i++) {
+        r.numVazias += celulas[i] == 0;
+    }
+
+    // Caminho rápido: nenhuma unidade tem dígito repetido
+    if (algumDuplicado) {
+        for (int i = 0; i < 81; i++) {
+            const uint8_t* u = UNIDADES_DA_CELULA[i];
+            uint16_t repetidos = duplicados[u[0]] | duplicados[u[1]] | duplicados[u[2]];
+            r.numConflitos += (repetidos & bitDoValor(celulas[i])) != 0;
+        }
+    }
+
+    if (r.numConflitos > 0) {
+        r.resultado = ResultadoValidacao::INVALIDO;
+    } else if (r.numVazias > 0) {
+        r.resultado = ResultadoValidacao::INCOMPLETO;
+    } else {
+        r.resultado = ResultadoValidacao::VALIDO;
+    }
+    return r;
+}
+
+// Kernel portável: para cada unidade, "duplicados |= vistos & bit; vistos |= bit"
+ResultadoMascara kernelEscalar(const uint8_t* celulas) {
+    uint16_t duplicados[27];
+    uint16_t algum = 0;
+
+    for (int u = 0; u < 27; u++) {
+        uint16_t vistos = 0;
+        uint16_t dup = 0;
+        for (int p = 0; p < 9; p++) {
+            uint16_t bit = bitDoValor(celulas[CELULAS_DA_UNIDADE[u][p]]);
+            dup |= vistos & bit;
+            vistos |= bit;
+        }
+        duplicados[u] = dup;
+        algum |= dup;
+    }
+
+    return finalizar(celulas, duplicados, algum != 0);
+}
+
+#ifdef VALIDADOR_MASCARA_X86
+
+// Reorganiza o tabuleiro para que cada pista de um vetor seja uma unidade.
+// As colunas já estão contíguas (a linha p traz a célula p de cada coluna);
+// linhas e blocos são reunidos pelas tabelas de índices.
+inline void montarOrdem(const uint8_t* celulas, uint8_t ordem[9][32]) {
+    for (int p = 0; p < 9; p++) {
+        uint8_t* destino = ordem[p];
+        for (int u = 0; u < 9; u++) {
+            destino[u] = celulas[u * 9 + p];
+        }
+        memcpy(destino + 9, celulas + p * 9, 9);
+        for (int u = 18; u < 27; u++) {
+            destino[u] = celulas[CELULAS_DA_UNIDADE[u][p]];
+        }
+        memset(destino + 27, 0, 5);
+    }
+}
+
+// A máscara de 9 bits é dividida em dois bytes: dígitos 1-8 no byte baixo e o 9 no alto.
+// Assim a conversão valor -> bit é um único pshufb por byte.
+__attribute__((target("ssse3")))
+ResultadoMascara kernelSsse3(const uint8_t* celulas) {
+    alignas(16) uint8_t ordem[9][32];
+    montarOrdem(celulas, ordem);
+
+    const __m128i tabBaixo = _mm_setr_epi8(0, 1, 2, 4, 8, 16, 32, 64, (char)128, 0, 0, 0, 0, 0, 0, 0);
+    const __m128i tabAlto  = _mm_setr_epi8(0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0);
+
+    __m128i vistosBaixo[2], vistosAlto[2], dupBaixo[2], dupAlto[2];
+    for (int k = 0; k < 2; k++) {
+        vistosBaixo[k] = vistosAlto[k] = dupBaixo[k] = dupAlto[k] = _mm_setzero_si128();
+    }
+
+    for (int p = 0; p < 9; p++) {
+        for (int k = 0; k < 2; k++) {
+            __m128i v = _mm_load_si128(reinterpret_cast<const __m128i*>(&ordem[p][16 * k]));
+            __m128i baixo = _mm_shuffle_epi8(tabBaixo, v);
+            __m128i alto = _mm_shuffle_epi8(tabAlto, v);
+            dupBaixo[k] = _mm_or_si128(dupBaixo[k], _mm_and_si128(vistosBaixo[k], baixo));
+            dupAlto[k] = _mm_or_si128(dupAlto[k], _mm_and_si128(vistosAlto[k], alto));
+            vistosBaixo[k] = _mm_or_si128(vistosBaixo[k], baixo);
+            vistosAlto[k] = _mm_or_si128(vistosAlto[k], alto);
+        }
+    }
+
+    alignas(16) uint8_t baixo[32], alto[32];
+    __m128i qualquer = _mm_setzero_si128();
+    for (int k = 0; k < 2; k++) {
+        _mm_store_si128(reinterpret_cast<__m128i*>(&baixo[16 * k]), dupBaixo[k]);
+        _mm_store_si128(reinterpret_cast<__m128i*>(&alto[16 * k]), dupAlto[k]);
+        qualquer = _mm_or_si128(qualquer, _mm_or_si128(dupBaixo[k], dupAlto[k]));
+    }
+
+    uint16_t duplicados[27];
+    for (int u = 0; u < 27; u++) {
+        duplicados[u] = static_cast<uint16_t>(baixo[u] | (alto[u] << 8));
+    }
+
+    bool algum = _mm_movemask_epi8(_mm_cmpeq_epi8(qualquer, _mm_setzero_si128())) != 0xFFFF;
+    return finalizar(celulas, duplicados, algum);
+}
+
+// Mesmo algoritmo do SSSE3, com as 27 unidades em um único registrador de 32 pistas
+__attribute__((target("avx2")))
+ResultadoMascara kernelAvx2(const uint8_t* celulas) {
+    alignas(32) uint8_t ordem[9][32];
+    montarOrdem(celulas, ordem);
+
+    const __m256i tabBaixo = _mm256_setr_epi8(0, 1, 2, 4, 8, 16, 32, 64, (char)128, 0, 0, 0, 0, 0, 0, 0,
+                                              0, 1, 2, 4, 8, 16, 32, 64, (char)128, 0, 0, 0, 0, 0, 0, 0);
+    const __m256i tabAlto  = _mm256_setr_epi8(0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0,
+                                              0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0);
+
+    __m256i vistosBaixo = _mm256_setzero_si256();
+    __m256i vistosAlto = _mm256_setzero_si256();
+    __m256i dupBaixo = _mm256_setzero_si256();
+    __m256i dupAlto = _mm256_setzero_si256();
+
+    for (int p = 0; p < 9; p++) {
+        __m256i v = _mm256_load_si256(reinterpret_cast<const __m256i*>(ordem[p]));
+        __m256i baixo = _mm256_shuffle_epi8(tabBaixo, v);
+        __m256i alto = _mm256_shuffle_epi8(tabAlto, v);
+        dupBaixo = _mm256_or_si256(dupBaixo, _mm256_and_si256(vistosBaixo, baixo));
+        dupAlto = _mm256_or_si256(dupAlto, _mm256_and_si256(vistosAlto, alto));
+        vistosBaixo = _mm256_or_si256(vistosBaixo, baixo);
+        vistosAlto = _mm256_or_si256(vistosAlto, alto);
+    }
+
+    alignas(32) uint8_t baixo[32], alto[32];
+    _mm256_store_si256(reinterpret_cast<__m256i*>(baixo), dupBaixo);
+    _mm256_store_si256(reinterpret_cast<__m256i*>(alto), dupAlto);
+
+    uint16_t duplicados[27];
+    for (int u = 0; u < 27; u++) {
+        duplicados[u] = static_cast<uint16_t>(baixo[u] | (alto[u] << 8));
+    }
+
+    __m256i qualquer = _mm256_or_si256(dupBaixo, dupAlto);
+    return finalizar(celulas, duplicados, !_mm256_testz_si256(qualquer, qualquer));
+}
+
+#endif // VALIDADOR_MASCARA_X86
+
+} // namespace
+
+KernelMascara kernelMascaraAtivo() {
+#ifdef VALIDADOR_MASCARA_X86
+    static const KernelMascara kernel =
+        __builtin_cpu_supports("avx2")  ? KernelMascara::AVX2 :
+        __builtin_cpu_supports("ssse3") ? KernelMascara::SSSE3 :
+                                          KernelMascara::ESCALAR;
+    return kernel;
+#else
+    return KernelMascara::ESCALAR;
+#endif
+}
+
+const char* nomeKernelMascara(KernelMascara kernel) {
+    switch (kernel) {
+        case KernelMascara::AVX2:  return "AVX2";
+        case KernelMascara::SSSE3: return "SSSE3";
+        default:                   return "escalar";
+    }
+}
+
+ResultadoMascara validarComMascaras(const uint8_t celulas[81]) {
+    return validarComMascaras(celulas, kernelMascaraAtivo());
+}
+
+ResultadoMascara validarComMascaras(const uint8_t celulas[81], KernelMascara kernel) {
+#ifdef VALIDADOR_MASCARA_X86
+    // Nunca executa um kernel acima do que a CPU suporta
+    KernelMascara suportado = kernelMascaraAtivo();
+    if (kernel == KernelMascara::AVX2 && suportado == KernelMascara::AVX2) {
+        return kernelAvx2(celulas);
+    }
+    if (kernel != KernelMascara::ESCALAR && suportado != KernelMascara::ESCALAR) {
+        return kernelSsse3(celulas);
+    }
+#else
+    (void)kernel;
+#endif
+    return kernelEscalar(celulas);
+}
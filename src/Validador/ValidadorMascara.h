@@ -0,0 +1,41 @@
+#ifndef VALIDADORMASCARA_H
+#define VALIDADORMASCARA_H
+
+#include <cstdint>
+
+// Resultado de uma validação completa do tabuleiro
+enum class ResultadoValidacao {
+    VALIDO,      // sem conflitos e sem células vazias
+    INVALIDO,    // pelo menos um conflito
+    INCOMPLETO   // sem conflitos, mas com células vazias
+};
+
+// Struct com o resultado do validador por máscaras de bits
+struct ResultadoMascara {
+    ResultadoValidacao resultado;
+    int numConflitos;   // células cujo valor se repete em alguma linha, coluna ou bloco
+    int numVazias;      // células com valor 0
+};
+
+// Kernels disponíveis para o validador por máscaras
+enum class KernelMascara {
+    ESCALAR,  // truques de bits portáveis
+    SSSE3,    // 16 unidades por instrução
+    AVX2      // 32 unidades por instrução
+};
+
+// Valida as 27 unidades (9 linhas, 9 colunas e 9 blocos) de um tabuleiro 9x9
+// armazenado linha a linha em 81 bytes (0 = vazio). Cada unidade vira uma máscara
+// de 9 bits; o kernel mais rápido suportado pela CPU é escolhido em tempo de execução.
+ResultadoMascara validarComMascaras(const uint8_t celulas[81]);
+
+// Mesma validação forçando um kernel específico (cai para o escalar se não houver suporte)
+ResultadoMascara validarComMascaras(const uint8_t celulas[81], KernelMascara kernel);
+
+// Kernel escolhido em tempo de execução para esta CPU
+KernelMascara kernelMascaraAtivo();
+
+// Nome legível do kernel ("escalar", "SSSE3", "AVX2")
+const char* nomeKernelMascara(KernelMascara kernel);
+
+#endif // VALIDADORMASCARA_H
@@ -0,0 +1,132 @@
+#include "ValidadorN.h"
+#include <algorithm>
+#include <ctime>
+
+using namespace std;
+
+namespace {
+
+// Máscaras de duplicados das unidades [inicio, fim)
+template <int B>
+void duplicadosDasUnidades(const TabuleiroN<B>& t, int inicio, int fim,
+                           typename TabuleiroN<B>::Mascara* duplicados) {
+    typedef TabuleiroN<B> T;
+    typedef typename T::Mascara Mascara;
+
+    for (int u = inicio; u < fim; u++) {
+        Mascara vistos = 0;
+        Mascara dup = 0;
+        for (int p = 0; p < T::LADO; p++) {
+            Mascara bit = T::bitDoValor(t.celulas[T::celulaDaUnidade(u, p)]);
+            dup |= vistos & bit;
+            vistos |= bit;
+        }
+        duplicados[u] = dup;
+    }
+}
+
+// Conta vazias e células em conflito, como finalizar() do validador 9x9
+template <int B>
+ResultadoMascara finalizarN(const TabuleiroN<B>& t, const typename TabuleiroN<B>::Mascara* duplicados) {
+    typedef TabuleiroN<B> T;
+    typedef typename T::Mascara Mascara;
+
+    Mascara algum = 0;
+    for (int u = 0; u < T::NUM_UNIDADES; u++) {
+        algum |= duplicados[u];
+    }
+
+    ResultadoMascara r;
+    r.numConflitos = 0;
+    r.numVazias = 0;
+    for (int i = 0; i < T::NUM_CELULAS; i++) {
+        r.numVazias += t.celulas[i] == 0;
+    }
+
+    // Caminho rápido: nenhuma unidade tem dígito repetido
+    if (algum) {
+        for (int i = 0; i < T::NUM_CELULAS; i++) {
+            Mascara repetidos = duplicados[T::linhaDa(i)] |
+                                duplicados[T::LADO + T::colunaDa(i)] |
+                                duplicados[2 * T::LADO + T::blocoDa(i)];
+            r.numConflitos += (repetidos & T::bitDoValor(t.celulas[i])) != 0;
+        }
+    }
+
+    if (r.numConflitos > 0) {
+        r.resultado = ResultadoValidacao::INVALIDO;
+    } else if (r.numVazias > 0) {
+        r.resultado = ResultadoValidacao::INCOMPLETO;
+    } else {
+        r.resultado = ResultadoValidacao::VALIDO;
+    }
+    return r;
+}
+
+} // namespace
+
+template <int B>
+ResultadoMascara validarN(const TabuleiroN<B>& tabuleiro) {
+    typename TabuleiroN<B>::Mascara duplicados[TabuleiroN<B>::NUM_UNIDADES];
+    duplicadosDasUnidades<B>(tabuleiro, 0, TabuleiroN<B>::NUM_UNIDADES, duplicados);
+    return finalizarN<B>(tabuleiro, duplicados);
+}
+
+// 9x9: mesmo layout de Tabuleiro, usa o caminho com tabelas e SIMD
+template <>
+ResultadoMascara validarN<3>(const TabuleiroN<3>& tabuleiro) {
+    return validarComMascaras(tabuleiro.celulas);
+}
+
+template <int B>
+ResultadoMascara validarNParalelo(const TabuleiroN<B>& tabuleiro, ThreadPool& pool, ValidacaoStats* stats) {
+    typedef TabuleiroN<B> T;
+
+    auto inicio = chrono::high_resolution_clock::now();
+    std::clock_t inicioCpu = std::clock();
+
+    // Uma faixa de unidades por thread, nunca mais faixas do que unidades
+    int numUnidades = T::NUM_UNIDADES;
+    int numTarefas = min<int>(numUnidades, max<int>(1, static_cast<int>(pool.numThreads())));
+
+    typename T::Mascara duplicados[T::NUM_UNIDADES];
+    ThreadPool::Lote lote(pool);
+    for (int k = 0; k < numTarefas; k++) {
+        int ini = numUnidades * k / numTarefas;
+        int fim = numUnidades * (k + 1) / numTarefas;
+        typename T::Mascara* destino = duplicados;
+        const T* origem = &tabuleiro;
+        lote.enviar([origem, ini, fim, destino]() {
+            duplicadosDasUnidades<B>(*origem, ini, fim, destino);
+        });
+    }
+    lote.aguardar();
+
+    ResultadoMascara r = finalizarN<B>(tabuleiro, duplicados);
+
+    if (stats) {
+        auto fim = chrono::high_resolution_clock::now();
+        stats->tempoExecucao           = chrono::duration_cast<chrono::milliseconds>(fim - inicio);
+        stats->tempoEmNs               = chrono::duration_cast<chrono::nanoseconds>(fim - inicio);
+        stats->cpuTicks                = std::clock() - inicioCpu;
+        stats->numCelulasVerificadas   = static_cast<long long>(T::NUM_CELULAS) * 3;
+        stats->numConflitosEncontrados = r.numConflitos;
+        stats->numThreadsUsadas        = min<int>(numTarefas, static_cast<int>(pool.numThreads()));
+        stats->numTarefas              = lote.numTarefas();
+        stats->tempoEmFila             = lote.tempoEmFila();
+        stats->tempoTarefas            = lote.tempoExecutando();
+    }
+    return r;
+}
+
+// Instanciações explícitas dos tamanhos suportados
+template ResultadoMascara validarN<4>(const TabuleiroN<4>&);
+template ResultadoMascara validarN<5>(const TabuleiroN<5>&);
+template ResultadoMascara validarN<6>(const TabuleiroN<6>&);
+template ResultadoMascara validarN<8>(const TabuleiroN<8>&);
+
+template ResultadoMascara validarNParalelo<3>(const TabuleiroN<3>&, ThreadPool&, ValidacaoStats*);
+template ResultadoMascara validarNParalelo<4>(const TabuleiroN<4>&, ThreadPool&, ValidacaoStats*);
+template ResultadoMascara validarNParalelo<5>(const TabuleiroN<5>&, ThreadPool&, ValidacaoStats*);
+template ResultadoMascara validarNParalelo<6>(const TabuleiroN<6>&, ThreadPool&, ValidacaoStats*);
+template ResultadoMascara validarNParalelo<8>(const TabuleiroN<8>&, ThreadPool&, ValidacaoStats*);
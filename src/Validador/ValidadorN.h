@@ -0,0 +1,26 @@
+#ifndef VALIDADORN_H
+#define VALIDADORN_H
+
+#include "../Tabuleiro/TabuleiroN.h"
+#include "../ThreadPool/ThreadPool.h"
+#include "ValidadorMascara.h"
+#include "ValidacaoStats.h"
+
+// Validador por máscaras para tabuleiros N x N.
+// Cada unidade vira uma máscara de N bits (uint16/uint32/uint64 conforme N) com
+// "duplicados |= vistos & bit; vistos |= bit". Para B = 3 delega ao validador
+// 9x9 com tabelas literais e kernels SIMD.
+template <int B>
+ResultadoMascara validarN(const TabuleiroN<B>& tabuleiro);
+
+template <>
+ResultadoMascara validarN<3>(const TabuleiroN<3>& tabuleiro);
+
+// Mesma validação com as 3N unidades divididas em faixas contíguas entre as
+// threads do pool: o número de tarefas acompanha o número de unidades e de
+// threads, em vez de ser fixo. 'stats' (opcional) recebe os tempos do lote.
+template <int B>
+ResultadoMascara validarNParalelo(const TabuleiroN<B>& tabuleiro, ThreadPool& pool,
+                                  ValidacaoStats* stats = nullptr);
+
+#endif // VALIDADORN_H
@@ -0,0 +1,229 @@
+#include "ValidadorSoA.h"
+#include <cstring>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define VALIDADOR_SOA_X86 1
+#include <immintrin.h>
+#endif
+
+using namespace std;
+
+namespace {
+
+// Monta o resultado de uma pista a partir das contagens do kernel
+inline ResultadoMascara montarResultado(int numConflitos, int numVazias) {
+    ResultadoMascara r;
+    r.numConflitos = numConflitos;
+    r.numVazias = numVazias;
+    if (numConflitos > 0) {
+        r.resultado = ResultadoValidacao::INVALIDO;
+    } else if (numVazias > 0) {
+        r.resultado = ResultadoValidacao::INCOMPLETO;
+    } else {
+        r.resultado = ResultadoValidacao::VALIDO;
+    }
+    return r;
+}
+
+// Kernel portável: extrai cada pista e usa o validador escalar de um tabuleiro
+void kernelSoAEscalar(const BlocoSoA& bloco, ResultadoMascara* saida) {
+    Tabuleiro tabuleiro;
+    for (int t = 0; t < bloco.numTabuleiros; t++) {
+        extrairDoSoA(bloco, t, tabuleiro);
+        saida[t] = validarComMascaras(tabuleiro.celulas, KernelMascara::ESCALAR);
+    }
+}
+
+#ifdef VALIDADOR_SOA_X86
+
+// Os kernels seguem o validador por máscaras: a máscara de 9 bits de cada unidade
+// fica em dois bytes (dígitos 1-8 no baixo, 9 no alto) e o pshufb converte valor
+// em bit. A diferença é que aqui cada pista é um tabuleiro, e não uma unidade:
+// 'vistos' e 'duplicados' são vetores por unidade, atualizados célula a célula.
+// Uma segunda passada, só quando há algum duplicado, conta as células em conflito.
+
+__attribute__((target("ssse3")))
+void kernelSoASsse3(const BlocoSoA& bloco, ResultadoMascara* saida) {
+    const __m128i tabBaixo = _mm_setr_epi8(0, 1, 2, 4, 8, 16, 32, 64, (char)128, 0, 0, 0, 0, 0, 0, 0);
+    const __m128i tabAlto  = _mm_setr_epi8(0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0);
+    const __m128i zero = _mm_setzero_si128();
+
+    alignas(16) uint8_t conflitos[LARGURA_SOA];
+    alignas(16) uint8_t vazias[LARGURA_SOA];
+
+    // Duas metades de 16 pistas
+    for (int metade = 0; metade < 2; metade++) {
+        int base = 16 * metade;
+        __m128i vistosBaixo[27], vistosAlto[27], dupBaixo[27], dupAlto[27];
+        for (int u = 0; u < 27; u++) {
+            vistosBaixo[u] = vistosAlto[u] = dupBaixo[u] = dupAlto[u] = zero;
+        }
+
+        __m128i numVazias = zero;
+        for (int i = 0; i < 81; i++) {
+            __m128i v = _mm_load_si128(reinterpret_cast<const __m128i*>(&bloco.celulas[i][base]));
+            __m128i baixo = _mm_shuffle_epi8(tabBaixo, v);
+            __m128i alto = _mm_shuffle_epi8(tabAlto, v);
+            numVazias = _mm_sub_epi8(numVazias, _mm_cmpeq_epi8(v, zero));
+
+            for (int u : UNIDADES_DA_CELULA[i]) {
+                dupBaixo[u] = _mm_or_si128(dupBaixo[u], _mm_and_si128(vistosBaixo[u], baixo));
+                dupAlto[u] = _mm_or_si128(dupAlto[u], _mm_and_si128(vistosAlto[u], alto));
+                vistosBaixo[u] = _mm_or_si128(vistosBaixo[u], baixo);
+                vistosAlto[u] = _mm_or_si128(vistosAlto[u], alto);
+            }
+        }
+        _mm_store_si128(reinterpret_cast<__m128i*>(&vazias[base]), numVazias);
+
+        __m128i qualquer = zero;
+        for (int u = 0; u < 27; u++) {
+            qualquer = _mm_or_si128(qualquer, _mm_or_si128(dupBaixo[u], dupAlto[u]));
+        }
+
+        // Caminho rápido: nenhum tabuleiro da metade tem dígito repetido
+        __m128i semConflito = _mm_set1_epi8(81);
+        if (_mm_movemask_epi8(_mm_cmpeq_epi8(qualquer, zero)) != 0xFFFF) {
+            semConflito = zero;
+            for (int i = 0; i < 81; i++) {
+                __m128i v = _mm_load_si128(reinterpret_cast<const __m128i*>(&bloco.celulas[i][base]));
+                int l = UNIDADES_DA_CELULA[i][0], c = UNIDADES_DA_CELULA[i][1], b = UNIDADES_DA_CELULA[i][2];
+                __m128i repBaixo = _mm_or_si128(dupBaixo[l], _mm_or_si128(dupBaixo[c], dupBaixo[b]));
+                __m128i repAlto = _mm_or_si128(dupAlto[l], _mm_or_si128(dupAlto[c], dupAlto[b]));
+                __m128i atinge = _mm_or_si128(_mm_and_si128(repBaixo, _mm_shuffle_epi8(tabBaixo, v)),
+                                              _mm_and_si128(repAlto, _mm_shuffle_epi8(tabAlto, v)));
+                semConflito = _mm_sub_epi8(semConflito, _mm_cmpeq_epi8(atinge, zero));
+            }
+        }
+        // conflitos = 81 - células sem conflito (vazias nunca estão em conflito)
+        _mm_store_si128(reinterpret_cast<__m128i*>(&conflitos[base]),
+                        _mm_sub_epi8(_mm_set1_epi8(81), semConflito));
+    }
+
+    for (int t = 0; t < bloco.numTabuleiros; t++) {
+        saida[t] = montarResultado(conflitos[t], vazias[t]);
+    }
+}
+
+// Mesmo algoritmo do SSSE3, com as 32 pistas em um único registrador
+__attribute__((target("avx2")))
+void kernelSoAAvx2(const BlocoSoA& bloco, ResultadoMascara* saida) {
+    const __m256i tabBaixo = _mm256_setr_epi8(0, 1, 2, 4, 8, 16, 32, 64, (char)128, 0, 0, 0, 0, 0, 0, 0,
+                                              0, 1, 2, 4, 8, 16, 32, 64, (char)128, 0, 0, 0, 0, 0, 0, 0);
+    const __m256i tabAlto  = _mm256_setr_epi8(0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0,
+                                              0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0);
+    const __m256i zero = _mm256_setzero_si256();
+
+    __m256i vistosBaixo[27], vistosAlto[27], dupBaixo[27], dupAlto[27];
+    for (int u = 0; u < 27; u++) {
+        vistosBaixo[u] = vistosAlto[u] = dupBaixo[u] = dupAlto[u] = zero;
+    }
+
+    __m256i numVazias = zero;
+    for (int i = 0; i < 81; i++) {
+        __m256i v = _mm256_load_si256(reinterpret_cast<const __m256i*>(bloco.celulas[i]));
+        __m256i baixo = _mm256_shuffle_epi8(tabBaixo, v);
+        __m256i alto = _mm256_shuffle_epi8(tabAlto, v);
+        numVazias = _mm256_sub_epi8(numVazias, _mm256_cmpeq_epi8(v, zero));
+
+        for (int u : UNIDADES_DA_CELULA[i]) {
+            dupBaixo[u] = _mm256_or_si256(dupBaixo[u], _mm256_and_si256(vistosBaixo[u], baixo));
+            dupAlto[u] = _mm256_or_si256(dupAlto[u], _mm256_and_si256(vistosAlto[u], alto));
+            vistosBaixo[u] = _mm256_or_si256(vistosBaixo[u], baixo);
+            vistosAlto[u] = _mm256_or_si256(vistosAlto[u], alto);
+        }
+    }
+
+    __m256i qualquer = zero;
+    for (int u = 0; u < 27; u++) {
+        qualquer = _mm256_or_si256(qualquer, _mm256_or_si256(dupBaixo[u], dupAlto[u]));
+    }
+
+    __m256i semConflito = _mm256_set1_epi8(81);
+    if (!_mm256_testz_si256(qualquer, qualquer)) {
+        semConflito = zero;
+        for (int i = 0; i < 81; i++) {
+            __m256i v = _mm256_load_si256(reinterpret_cast<const __m256i*>(bloco.celulas[i]));
+            int l = UNIDADES_DA_CELULA[i][0], c = UNIDADES_DA_CELULA[i][1], b = UNIDADES_DA_CELULA[i][2];
+            __m256i repBaixo = _mm256_or_si256(dupBaixo[l], _mm256_or_si256(dupBaixo[c], dupBaixo[b]));
+            __m256i repAlto = _mm256_or_si256(dupAlto[l], _mm256_or_si256(dupAlto[c], dupAlto[b]));
+            __m256i atinge = _mm256_or_si256(_mm256_and_si256(repBaixo, _mm256_shuffle_epi8(tabBaixo, v)),
+                                             _mm256_and_si256(repAlto, _mm256_shuffle_epi8(tabAlto, v)));
+            semConflito = _mm256_sub_epi8(semConflito, _mm256_cmpeq_epi8(atinge, zero));
+        }
+    }
+
+    alignas(32) uint8_t conflitos[LARGURA_SOA];
+    alignas(32) uint8_t vazias[LARGURA_SOA];
+    _mm256_store_si256(reinterpret_cast<__m256i*>(conflitos), _mm256_sub_epi8(_mm256_set1_epi8(81), semConflito));
+    _mm256_store_si256(reinterpret_cast<__m256i*>(vazias), numVazias);
+
+    for (int t = 0; t < bloco.numTabuleiros; t++) {
+        saida[t] = montarResultado(conflitos[t], vazias[t]);
+    }
+}
+
+#endif // VALIDADOR_SOA_X86
+
+} // namespace
+
+void transporParaSoA(const Tabuleiro* tabuleiros, int quantidade, BlocoSoA& bloco) {
+    if (quantidade > LARGURA_SOA) {
+        quantidade = LARGURA_SOA;
+    }
+    bloco.numTabuleiros = quantidade;
+    if (quantidade < LARGURA_SOA) {
+        memset(bloco.celulas, 0, sizeof(bloco.celulas));
+    }
+
+    // Lê cada tabuleiro em sequência e espalha as células com passo de 32 bytes;
+    // o bloco inteiro (2,5 KB) fica na L1 durante a transposição
+    for (int t = 0; t < quantidade; t++) {
+        const uint8_t* origem = tabuleiros[t].celulas;
+        for (int i = 0; i < 81; i++) {
+            bloco.celulas[i][t] = origem[i];
+        }
+    }
+}
+
+void extrairDoSoA(const BlocoSoA& bloco, int pista, Tabuleiro& tabuleiro) {
+    for (int i = 0; i < 81; i++) {
+        tabuleiro.celulas[i] = bloco.celulas[i][pista];
+    }
+}
+
+void validarBlocoSoA(const BlocoSoA& bloco, ResultadoMascara* saida) {
+    validarBlocoSoA(bloco, saida, kernelMascaraAtivo());
+}
+
+void validarBlocoSoA(const BlocoSoA& bloco, ResultadoMascara* saida, KernelMascara kernel) {
+#ifdef VALIDADOR_SOA_X86
+    // Nunca executa um kernel acima do que a CPU suporta
+    KernelMascara suportado = kernelMascaraAtivo();
+    if (kernel == KernelMascara::AVX2 && suportado == KernelMascara::AVX2) {
+        kernelSoAAvx2(bloco, saida);
+        return;
+    }
+    if (kernel != KernelMascara::ESCALAR && suportado != KernelMascara::ESCALAR) {
+        kernelSoASsse3(bloco, saida);
+        return;
+    }
+#else
+    (void)kernel;
+#endif
+    kernelSoAEscalar(bloco, saida);
+}
+
+void validarLoteSoA(const Tabuleiro* tabuleiros, size_t quantidade, ResultadoMascara* saida) {
+    BlocoSoA bloco;
+    size_t completos = quantidade - quantidade % LARGURA_SOA;
+
+    for (size_t inicio = 0; inicio < completos; inicio += LARGURA_SOA) {
+        transporParaSoA(tabuleiros + inicio, LARGURA_SOA, bloco);
+        validarBlocoSoA(bloco, saida + inicio);
+    }
+
+    // Sobra que não preenche um bloco: um tabuleiro por vez
+    for (size_t i = completos; i < quantidade; i++) {
+        saida[i] = validarComMascaras(tabuleiros[i].celulas);
+    }
+}
@@ -0,0 +1,38 @@
+#ifndef VALIDADORSOA_H
+#define VALIDADORSOA_H
+
+#include <cstddef>
+#include <cstdint>
+#include "../Tabuleiro/Tabuleiro.h"
+#include "ValidadorMascara.h"
+
+// Número de tabuleiros em um bloco transposto (uma pista AVX2 de 8 bits por tabuleiro)
+const int LARGURA_SOA = 32;
+
+// Bloco de até 32 tabuleiros em estrutura de vetores (SoA): celulas[i][t] é a
+// célula i do tabuleiro t. Cada linha de 32 bytes é um vetor em que cada pista é
+// um tabuleiro diferente, então as máscaras de linhas, colunas e blocos são
+// montadas pista a pista sem reorganizar bytes. Pistas sem tabuleiro ficam zeradas.
+struct alignas(32) BlocoSoA {
+    uint8_t celulas[81][LARGURA_SOA];
+    int numTabuleiros;
+};
+
+// Método para transpor até 32 tabuleiros para o formato SoA
+void transporParaSoA(const Tabuleiro* tabuleiros, int quantidade, BlocoSoA& bloco);
+
+// Método para recuperar o tabuleiro de uma pista do bloco
+void extrairDoSoA(const BlocoSoA& bloco, int pista, Tabuleiro& tabuleiro);
+
+// Valida todos os tabuleiros de um bloco; 'saida' recebe bloco.numTabuleiros resultados.
+// O kernel (escalar, SSSE3 com 2x16 pistas ou AVX2 com 32) é escolhido como em
+// validarComMascaras().
+void validarBlocoSoA(const BlocoSoA& bloco, ResultadoMascara* saida);
+void validarBlocoSoA(const BlocoSoA& bloco, ResultadoMascara* saida, KernelMascara kernel);
+
+// Valida 'quantidade' tabuleiros no formato normal: os grupos completos de 32 são
+// transpostos e validados pelo kernel SoA; a sobra (quantidade % 32) passa pelo
+// validador de um tabuleiro por vez.
+void validarLoteSoA(const Tabuleiro* tabuleiros, size_t quantidade, ResultadoMascara* saida);
+
+#endif // VALIDADORSOA_H
@@ -0,0 +1,245 @@
+#include "ValidadorUnidades.h"
+#include <chrono>
+#include <cstring>
+#include "../Log/LogAssincrono.h"
+#include "../Trace/Rastreador.h"
+
+using namespace std;
+
+namespace {
+
+const uint32_t TODAS_AS_UNIDADES = (1u << NUM_UNIDADES) - 1;
+
+// Nome e mensagem de conclusão de cada tipo de unidade (linhas, colunas, blocos)
+const char* const NOMES_TIPO[3] = { "Linhas", "Colunas", "Blocos" };
+const char* const FORMATOS_CONCLUSAO[3] = {
+    "[Thread {}] Validação de linhas {}-{} concluída em {}ms, {}, células em conflito: {}",
+    "[Thread {}] Validação de colunas {}-{} concluída em {}ms, {}, células em conflito: {}",
+    "[Thread {}] Validação de blocos {}-{} concluída em {}ms, {}, células em conflito: {}"
+};
+
+inline void marcarCelula(uint64_t conjunto[2], int celula) {
+    conjunto[celula >> 6] |= 1ull << (celula & 63);
+}
+
+inline bool contemCelula(const uint64_t conjunto[2], int celula) {
+    return (conjunto[celula >> 6] >> (celula & 63)) & 1;
+}
+
+vector<int> listarCelulas(const uint64_t conjunto[2]) {
+    vector<int> celulas;
+    for (int palavra = 0; palavra < 2; palavra++) {
+        for (uint64_t bits = conjunto[palavra]; bits; bits &= bits - 1) {
+            celulas.push_back(palavra * 64 + __builtin_ctzll(bits));
+        }
+    }
+    return celulas;
+}
+
+// Valida as unidades [primeira + ini, primeira + fim) da tabela CELULAS_DA_UNIDADE,
+// com primeira = 0, 9 ou 18 (linhas, colunas ou blocos)
+bool validarFaixa(const Tabuleiro& matriz, int primeira, int ini, int fim, ContextoValidacao* contexto) {
+    const char* nome = NOMES_TIPO[primeira / LADO_TABULEIRO];
+    auto inicio = chrono::high_resolution_clock::now();
+
+    bool valido = true;
+    int conflitosEncontrados = 0;
+    bool pararNoPrimeiro = contexto && contexto->getPolitica() == PoliticaValidacao::PARAR_NO_PRIMEIRO;
+
+    for (int u = ini; u < fim; u++) {
+        // Outra tarefa já reprovou o tabuleiro: o resultado não muda mais
+        if (pararNoPrimeiro && contexto->pararSolicitado()) {
+            LOG_INFO("[Thread {}] {} {}-{}: interrompida na unidade {} (problema encontrado em outra tarefa)",
+                     LogAssincrono::idThread(), nome, ini+1, fim, u+1);
+            return false;
+        }
+
+        const uint8_t* unidade = CELULAS_DA_UNIDADE[primeira + u];
+        uint16_t vistos = 0, repetidos = 0;
+        int vazia = -1;
+        for (int i = 0; i < LADO_TABULEIRO; i++) {
+            int valor = matriz.celulas[unidade[i]];
+            if (valor != 0) {
+                uint16_t bit = static_cast<uint16_t>(1u << valor);
+                repetidos |= vistos & bit;
+                vistos |= bit;
+            }
+            else if (vazia < 0) {
+                vazia = unidade[i];
+                LOG_INFO("[Thread {}] {} {}-{}: INCOMPLETO (célula vazia em {},{})",
+                         LogAssincrono::idThread(), nome, ini+1, fim,
+                         LINHA_DA_CELULA[vazia] + 1, COLUNA_DA_CELULA[vazia] + 1);
+                if (!contexto) {
+                    return false;  // Sinaliza "incompleto" como falso
+                }
+            }
+        }
+
+        // Segunda passada só quando há repetição: marca todas as células com o dígito repetido
+        uint64_t conflito[2] = {0, 0}, vazias[2] = {0, 0};
+        if (repetidos) {
+            for (int i = 0; i < LADO_TABULEIRO; i++) {
+                int valor = matriz.celulas[unidade[i]];
+                if (valor != 0 && (repetidos >> valor) & 1) {
+                    marcarCelula(conflito, unidade[i]);
+                    conflitosEncontrados++;
+                }
+            }
+        }
+        if (vazia >= 0) {
+            for (int i = 0; i < LADO_TABULEIRO; i++) {
+                if (matriz.celulas[unidade[i]] == 0) {
+                    marcarCelula(vazias, unidade[i]);
+                }
+            }
+        }
+
+        bool unidadeValida = repetidos == 0 && vazia < 0;
+        valido = valido && unidadeValida;
+        if (contexto) {
+            contexto->registrarUnidade(primeira + u, repetidos, conflito, vazias);
+            if (pararNoPrimeiro && !unidadeValida) {
+                LOG_INFO("[Thread {}] {} {}-{}: problema na unidade {}, demais tarefas interrompidas",
+                         LogAssincrono::idThread(), nome, ini+1, fim, u+1);
+                return false;
+            }
+        }
+    }
+
+    auto fimTempo = chrono::high_resolution_clock::now();
+    auto duracao = chrono::duration_cast<chrono::milliseconds>(fimTempo - inicio);
+
+    LOG_INFO(FORMATOS_CONCLUSAO[primeira / LADO_TABULEIRO],
+             LogAssincrono::idThread(), ini+1, fim, duracao.count(),
+             valido ? "válido" : "inválido", conflitosEncontrados);
+
+    return valido;
+}
+
+} // namespace
+
+// ---------------------------------------------------------------------------
+// Relatório
+
+RelatorioConflitos::RelatorioConflitos()
+    : unidadesVerificadas(0), unidadesComConflito(0), unidadesIncompletas(0) {
+    celulasEmConflito[0] = celulasEmConflito[1] = 0;
+    celulasVazias[0] = celulasVazias[1] = 0;
+    memset(digitosRepetidos, 0, sizeof(digitosRepetidos));
+}
+
+bool RelatorioConflitos::completo() const {
+    return unidadesVerificadas == TODAS_AS_UNIDADES;
+}
+
+bool RelatorioConflitos::valido() const {
+    return completo() && unidadesComConflito == 0 && unidadesIncompletas == 0;
+}
+
+int RelatorioConflitos::numUnidadesVerificadas() const {
+    return __builtin_popcount(unidadesVerificadas);
+}
+
+int RelatorioConflitos::numCelulasEmConflito() const {
+    return __builtin_popcountll(celulasEmConflito[0]) + __builtin_popcountll(celulasEmConflito[1]);
+}
+
+int RelatorioConflitos::numCelulasVazias() const {
+    return __builtin_popcountll(celulasVazias[0]) + __builtin_popcountll(celulasVazias[1]);
+}
+
+bool RelatorioConflitos::celulaEmConflito(int celula) const {
+    return contemCelula(celulasEmConflito, celula);
+}
+
+bool RelatorioConflitos::celulaVazia(int celula) const {
+    return contemCelula(celulasVazias, celula);
+}
+
+vector<int> RelatorioConflitos::listarCelulasEmConflito() const {
+    return listarCelulas(celulasEmConflito);
+}
+
+vector<int> RelatorioConflitos::listarCelulasVazias() const {
+    return listarCelulas(celulasVazias);
+}
+
+vector<int> RelatorioConflitos::listarUnidadesComConflito() const {
+    vector<int> unidades;
+    for (uint32_t bits = unidadesComConflito; bits; bits &= bits - 1) {
+        unidades.push_back(__builtin_ctz(bits));
+    }
+    return unidades;
+}
+
+// ---------------------------------------------------------------------------
+// Contexto compartilhado
+
+// Construtor
+ContextoValidacao::ContextoValidacao(PoliticaValidacao politica)
+    : politica(politica), parar(false), unidadesVerificadas(0),
+      unidadesComConflito(0), unidadesIncompletas(0) {
+    for (int k = 0; k < 2; k++) {
+        celulasEmConflito[k].store(0);
+        celulasVazias[k].store(0);
+    }
+    memset(digitosRepetidos, 0, sizeof(digitosRepetidos));
+}
+
+void ContextoValidacao::registrarUnidade(int unidade, uint16_t repetidos,
+                                         const uint64_t conflito[2], const uint64_t vazias[2]) {
+    uint32_t bit = 1u << unidade;
+    bool vazia = (vazias[0] | vazias[1]) != 0;
+
+    // Única escritora desta entrada; a leitura vem depois da sincronização do futuro
+    digitosRepetidos[unidade] = repetidos;
+    if (repetidos) {
+        unidadesComConflito.fetch_or(bit, memory_order_relaxed);
+        celulasEmConflito[0].fetch_or(conflito[0], memory_order_relaxed);
+        celulasEmConflito[1].fetch_or(conflito[1], memory_order_relaxed);
+    }
+    if (vazia) {
+        unidadesIncompletas.fetch_or(bit, memory_order_relaxed);
+        celulasVazias[0].fetch_or(vazias[0], memory_order_relaxed);
+        celulasVazias[1].fetch_or(vazias[1], memory_order_relaxed);
+    }
+    unidadesVerificadas.fetch_or(bit, memory_order_relaxed);
+
+    if ((repetidos || vazia) && politica == PoliticaValidacao::PARAR_NO_PRIMEIRO) {
+        parar.store(true, memory_order_relaxed);
+    }
+}
+
+RelatorioConflitos ContextoValidacao::relatorio() const {
+    RelatorioConflitos r;
+    r.unidadesVerificadas = unidadesVerificadas.load();
+    r.unidadesComConflito = unidadesComConflito.load();
+    r.unidadesIncompletas = unidadesIncompletas.load();
+    for (int k = 0; k < 2; k++) {
+        r.celulasEmConflito[k] = celulasEmConflito[k].load();
+        r.celulasVazias[k] = celulasVazias[k].load();
+    }
+    memcpy(r.digitosRepetidos, digitosRepetidos, sizeof(digitosRepetidos));
+    return r;
+}
+
+// ---------------------------------------------------------------------------
+// Validadores
+
+// Função para validar linhas
+bool validarLinhas(const Tabuleiro& matriz, int startRow, int endRow, ContextoValidacao* contexto) {
+    RASTREAR("validarLinhas", "validacao");
+    return validarFaixa(matriz, 0, startRow, endRow, contexto);
+}
+
+// Função para validar colunas
+bool validarColunas(const Tabuleiro& matriz, int startCol, int endCol, ContextoValidacao* contexto) {
+    RASTREAR("validarColunas", "validacao");
+    return validarFaixa(matriz, LADO_TABULEIRO, startCol, endCol, contexto);
+}
+
+// Função para validar blocos 3x3
+bool validarBlocos(const Tabuleiro& matriz, int startBlock, int endBlock, ContextoValidacao* contexto) {
+    RASTREAR("validarBlocos", "validacao");
+    return validarFaixa(matriz, 2 * LADO_TABULEIRO, startBlock, endBlock, contexto);
+}
@@ -0,0 +1,103 @@
+#ifndef VALIDADORUNIDADES_H
+#define VALIDADORUNIDADES_H
+
+#include <atomic>
+#include <cstdint>
+#include <vector>
+#include "../Tabuleiro/Tabuleiro.h"
+
+// Comportamento dos validadores paralelos ao encontrar um problema
+enum class PoliticaValidacao {
+    RELATORIO,          // verifica todas as unidades e monta o relatório completo
+    PARAR_NO_PRIMEIRO   // o primeiro conflito ou célula vazia interrompe as demais tarefas
+};
+
+// Relatório estruturado de uma validação por unidades. As unidades seguem a
+// numeração de CELULAS_DA_UNIDADE (0-8 linhas, 9-17 colunas, 18-26 blocos) e
+// os conjuntos de células são bitsets de 81 bits (célula i no bit i % 64 da
+// palavra i / 64). Uma célula está em conflito quando seu dígito se repete em
+// alguma unidade que a contém.
+struct RelatorioConflitos {
+    uint32_t unidadesVerificadas;
+    uint32_t unidadesComConflito;
+    uint32_t unidadesIncompletas;              // unidades com célula vazia
+    uint64_t celulasEmConflito[2];
+    uint64_t celulasVazias[2];
+    uint16_t digitosRepetidos[NUM_UNIDADES];   // bit d: dígito d repetido na unidade
+
+    RelatorioConflitos();
+
+    // Todas as 27 unidades foram verificadas (false se a validação parou cedo)
+    bool completo() const;
+    bool valido() const;
+
+    int numUnidadesVerificadas() const;
+    int numCelulasEmConflito() const;
+    int numCelulasVazias() const;
+    bool celulaEmConflito(int celula) const;
+    bool celulaVazia(int celula) const;
+
+    // Listas em ordem crescente (índices de célula 0-80 e de unidade 0-26)
+    std::vector<int> listarCelulasEmConflito() const;
+    std::vector<int> listarCelulasVazias() const;
+    std::vector<int> listarUnidadesComConflito() const;
+};
+
+// Estado compartilhado pelas tarefas de uma validação paralela. As tarefas
+// juntam seus achados sem trava: os conjuntos são atômicos atualizados com
+// fetch_or e cada unidade pertence a uma única tarefa, então sua entrada em
+// digitosRepetidos tem um só escritor. relatorio() deve ser chamado depois
+// que todas as tarefas terminarem (após os futuros ou o lote).
+class ContextoValidacao {
+public:
+    explicit ContextoValidacao(PoliticaValidacao politica = PoliticaValidacao::RELATORIO);
+
+    PoliticaValidacao getPolitica() const { return politica; }
+
+    // No modo PARAR_NO_PRIMEIRO, indica que alguma tarefa já achou um problema
+    bool pararSolicitado() const { return parar.load(std::memory_order_relaxed); }
+
+    // Registra o resultado de uma unidade (chamado pelos validadores)
+    void registrarUnidade(int unidade, uint16_t repetidos,
+                          const uint64_t conflito[2], const uint64_t vazias[2]);
+
+    RelatorioConflitos relatorio() const;
+
+private:
+    PoliticaValidacao politica;
+    std::atomic<bool> parar;
+    std::atomic<uint32_t> unidadesVerificadas;
+    std::atomic<uint32_t> unidadesComConflito;
+    std::atomic<uint32_t> unidadesIncompletas;
+    std::atomic<uint64_t> celulasEmConflito[2];
+    std::atomic<uint64_t> celulasVazias[2];
+    uint16_t digitosRepetidos[NUM_UNIDADES];
+
+    ContextoValidacao(const ContextoValidacao&) = delete;
+    ContextoValidacao& operator=(const ContextoValidacao&) = delete;
+};
+
+// Validação de faixas de unidades de um tabuleiro 9x9, usada pelas tarefas
+// dos modos paralelos da classe Sudoku. Cada função só lê o tabuleiro, então
+// várias tarefas podem validar o mesmo tabuleiro ao mesmo tempo sem trava.
+// Retornam false se houver dígito repetido ou célula vazia na faixa, e
+// registram o progresso no log (nível INFO).
+//
+// Sem contexto, a função desiste na primeira célula vazia. Com contexto, cada
+// unidade é verificada por inteiro e registrada nele; na política
+// PARAR_NO_PRIMEIRO a função retorna na primeira unidade com problema e as
+// outras tarefas do mesmo contexto pulam as unidades que ainda não viram.
+
+// Função para validar as linhas [startRow, endRow)
+bool validarLinhas(const Tabuleiro& matriz, int startRow, int endRow,
+                   ContextoValidacao* contexto = nullptr);
+
+// Função para validar as colunas [startCol, endCol)
+bool validarColunas(const Tabuleiro& matriz, int startCol, int endCol,
+                    ContextoValidacao* contexto = nullptr);
+
+// Função para validar os blocos 3x3 [startBlock, endBlock)
+bool validarBlocos(const Tabuleiro& matriz, int startBlock, int endBlock,
+                   ContextoValidacao* contexto = nullptr);
+
+#endif // VALIDADORUNIDADES_H
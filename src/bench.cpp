@@ -0,0 +1,468 @@
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <cstring>
+#include <cstdlib>
+#include <climits>
+#include <memory>
+#include <vector>
+#include "Bench/Benchmark.h"
+#include "Sudoku/Sudoku.h"
+#include "Solver/ContadorSolucoes.h"
+#include "Solver/CorpusTeste.h"
+#include "Solver/EnumeradorSolucoes.h"
+#include "Gerador/FabricaPuzzles.h"
+#include "Validador/ValidadorLote.h"
+#include "Validador/ValidadorSoA.h"
+#include "Validador/ValidadorN.h"
+#include "Validador/ValidadorGrande.h"
+#include "Corpus/CorpusBinario.h"
+
+using namespace std;
+
+// Sementes fixas: os corpora são os mesmos em todas as execuções e máquinas
+const uint64_t SEMENTE_SOLUCOES = 2024;
+const uint64_t SEMENTE_PERTURBACAO = 7;
+const uint64_t SEMENTE_PUZZLES = 42;
+
+const int NUM_SOLUCOES = 4096;
+const int NUM_TABULEIROS_LOTE = 100000;
+const int NUM_PUZZLES = 64;
+
+// Corpora compartilhados pelos casos de benchmark
+struct Corpora {
+    vector<Tabuleiro> solucoes;      // soluções completas e válidas
+    vector<Tabuleiro> mistos;        // metade válidos, metade com um conflito
+    vector<PuzzleGerado> puzzles;    // quebra-cabeças difíceis com solução única
+};
+
+Corpora montarCorpora() {
+    Corpora c;
+
+    GeradorPuzzles gerador(SEMENTE_SOLUCOES);
+    c.solucoes.reserve(NUM_SOLUCOES);
+    for (int i = 0; i < NUM_SOLUCOES; i++) {
+        c.solucoes.push_back(gerador.gerarSolucao());
+    }
+
+    // Um tabuleiro em cada dois recebe um dígito trocado (conflito em 3 unidades)
+    Xoshiro256 rng(SEMENTE_PERTURBACAO);
+    c.mistos.resize(NUM_TABULEIROS_LOTE);
+    for (int i = 0; i < NUM_TABULEIROS_LOTE; i++) {
+        c.mistos[i] = c.solucoes[i % NUM_SOLUCOES];
+        if (i % 2) {
+            int celula = static_cast<int>(rng.abaixoDe(NUM_CELULAS));
+            c.mistos[i].celulas[celula] = static_cast<uint8_t>(c.mistos[i].celulas[celula] % 9 + 1);
+        }
+    }
+
+    // Um único trabalhador: o corpus não depende do número de threads da máquina
+    FabricaPuzzles fabrica(SEMENTE_PUZZLES, 1);
+    c.puzzles = fabrica.gerar(NUM_PUZZLES, Dificuldade::DIFICIL);
+    return c;
+}
+
+// Modos de validação da classe Sudoku sobre um tabuleiro 9x9 válido
+void benchValidacaoSudoku(ExecutorBench& bench) {
+    Sudoku sudoku;
+    sudoku.setSemente(SEMENTE_SOLUCOES);
+    sudoku.completarMatriz(true);
+
+    bench.medir("validacao9x9", "iniciarValidacao", 1, [&] {
+        sudoku.iniciarValidacao();
+        bench.consumir(sudoku.isValidThread());
+    });
+    bench.medir("validacao9x9", "iniciarValidacaoParalela", 1, [&] {
+        sudoku.iniciarValidacaoParalela();
+        bench.consumir(sudoku.isValidThread());
+    });
+    bench.medir("validacao9x9", "iniciarValidacaoParalelaDetalhada", 1, [&] {
+        sudoku.iniciarValidacaoParalelaDetalhada();
+        bench.consumir(sudoku.isValidThread());
+    });
+    bench.medir("validacao9x9", "iniciarValidacaoMascara", 1, [&] {
+        sudoku.iniciarValidacaoMascara();
+        bench.consumir(sudoku.isValidThread());
+    });
+
+    // API assíncrona: mesmo trabalho, com cópia do tabuleiro e conclusão pela última tarefa
+    bench.medir("validacao9x9", "validarAssincrono/PARALELA", 1, [&] {
+        bench.consumir(sudoku.validarAssincrono(ModoValidacao::PARALELA).get().valido);
+    });
+    bench.medir("validacao9x9", "validarAssincrono/MASCARA", 1, [&] {
+        bench.consumir(sudoku.validarAssincrono(ModoValidacao::MASCARA).get().valido);
+    });
+
+    // Tabuleiro com um conflito na primeira linha: relatório completo contra parada no primeiro
+    Tabuleiro invalido = sudoku.getTabuleiro();
+    invalido.set(0, 0, invalido.get(0, 1));
+    sudoku.setTabuleiro(invalido);
+    bench.medir("validacao9x9", "detalhada/conflito/RELATORIO", 1, [&] {
+        sudoku.iniciarValidacaoParalelaDetalhada();
+        bench.consumir(sudoku.getUltimasStats().numConflitosEncontrados);
+    });
+    sudoku.setPoliticaValidacao(PoliticaValidacao::PARAR_NO_PRIMEIRO);
+    bench.medir("validacao9x9", "detalhada/conflito/PARAR_NO_PRIMEIRO", 1, [&] {
+        sudoku.iniciarValidacaoParalelaDetalhada();
+        bench.consumir(sudoku.getUltimasStats().numConflitosEncontrados);
+    });
+}
+
+// Kernels de máscaras e validadores em lote
+void benchValidacaoLote(ExecutorBench& bench, const Corpora& c) {
+    const KernelMascara kernels[3] = { KernelMascara::ESCALAR, KernelMascara::SSSE3, KernelMascara::AVX2 };
+    for (KernelMascara kernel : kernels) {
+        bench.medir("mascaras", string("validarComMascaras/") + nomeKernelMascara(kernel), NUM_SOLUCOES, [&] {
+            for (const Tabuleiro& t : c.solucoes) {
+                bench.consumir(validarComMascaras(t.celulas, kernel).numConflitos);
+            }
+        });
+    }
+
+    vector<ResultadoMascara> saidaSoA(c.mistos.size());
+    bench.medir("lote", "validarLoteSoA", NUM_TABULEIROS_LOTE, [&] {
+        validarLoteSoA(c.mistos.data(), c.mistos.size(), saidaSoA.data());
+        bench.consumir(saidaSoA.back().numConflitos);
+    });
+
+    ValidadorLote validador;
+    vector<ResultadoValidacao> saidaLote(c.mistos.size());
+    bench.medir("lote", "ValidadorLote", NUM_TABULEIROS_LOTE, [&] {
+        bench.consumir(validador.validar(c.mistos.data(), c.mistos.size(), saidaLote.data()).validos);
+    });
+}
+
+// Leitura de tabuleiros: texto de 82 bytes por linha contra registros de 41 bytes
+void benchCorpus(ExecutorBench& bench, const Corpora& c) {
+    string texto(c.mistos.size() * 82, '\n');
+    vector<uint8_t> registros(c.mistos.size() * BYTES_POR_REGISTRO);
+    for (size_t i = 0; i < c.mistos.size(); i++) {
+        char linha[82];
+        c.mistos[i].paraTexto(linha);
+        memcpy(&texto[i * 82], linha, 81);
+        empacotarTabuleiro(c.mistos[i], &registros[i * BYTES_POR_REGISTRO]);
+    }
+
+    Tabuleiro t;
+    bench.medir("corpus", "carregarTexto", NUM_TABULEIROS_LOTE, [&] {
+        for (size_t i = 0; i < c.mistos.size(); i++) {
+            bench.consumir(t.carregarTexto(&texto[i * 82]));
+        }
+    });
+    bench.medir("corpus", "desempacotarTabuleiro", NUM_TABULEIROS_LOTE, [&] {
+        for (size_t i = 0; i < c.mistos.size(); i++) {
+            bench.consumir(desempacotarTabuleiro(&registros[i * BYTES_POR_REGISTRO], t));
+        }
+    });
+}
+
+// Estrutura anterior de podeColocar, mantida só como referência: varre linha,
+// coluna e bloco com um teste de "é a própria célula" em cada iteração
+bool podeColocarPorVarredura(const Tabuleiro& t, int row, int col, int value) {
+    for (int i = 0; i < LADO_TABULEIRO; i++) {
+        if (t.get(row, i) == value && i != col) {
+            return false;
+        }
+    }
+    for (int i = 0; i < LADO_TABULEIRO; i++) {
+        if (t.get(i, col) == value && i != row) {
+            return false;
+        }
+    }
+    int startRow = row - row % LADO_BLOCO;
+    int startCol = col - col % LADO_BLOCO;
+    for (int i = 0; i < LADO_BLOCO; i++) {
+        for (int j = 0; j < LADO_BLOCO; j++) {
+            if (t.get(i + startRow, j + startCol) == value &&
+                (i + startRow != row || j + startCol != col)) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+// podeColocar em todas as células: nas soluções toda consulta percorre os
+// vizinhos até o fim; nos tabuleiros mistos algumas param no primeiro conflito
+void benchVizinhanca(ExecutorBench& bench, const Corpora& c) {
+    const long long consultas = static_cast<long long>(NUM_SOLUCOES) * NUM_CELULAS;
+    const vector<Tabuleiro>* corpora[2] = { &c.solucoes, &c.mistos };
+    const char* nomes[2] = { "solucoes", "mistos" };
+    for (int k = 0; k < 2; k++) {
+        const vector<Tabuleiro>& tabuleiros = *corpora[k];
+        bench.medir("vizinhanca", string("varreduraLinhaColunaBloco/") + nomes[k], consultas, [&] {
+            int aceitos = 0;
+            for (int i = 0; i < NUM_SOLUCOES; i++) {
+                const Tabuleiro& t = tabuleiros[i];
+                for (int celula = 0; celula < NUM_CELULAS; celula++) {
+                    aceitos += podeColocarPorVarredura(t, LINHA_DA_CELULA[celula], COLUNA_DA_CELULA[celula],
+                                                       t.celulas[celula]);
+                }
+            }
+            bench.consumir(aceitos);
+        });
+        bench.medir("vizinhanca", string("podeColocar/") + nomes[k], consultas, [&] {
+            int aceitos = 0;
+            for (int i = 0; i < NUM_SOLUCOES; i++) {
+                const Tabuleiro& t = tabuleiros[i];
+                for (int celula = 0; celula < NUM_CELULAS; celula++) {
+                    aceitos += t.podeColocar(LINHA_DA_CELULA[celula], COLUNA_DA_CELULA[celula],
+                                             t.celulas[celula]);
+                }
+            }
+            bench.consumir(aceitos);
+        });
+    }
+}
+
+// Copia um tabuleiro grande válido para a representação com template
+template <int B>
+unique_ptr<TabuleiroN<B> > tabuleiroNValido() {
+    Xoshiro256 rng(SEMENTE_SOLUCOES);
+    TabuleiroGrande grande(B);
+    grande.preencherValido(rng);
+
+    unique_ptr<TabuleiroN<B> > t(new TabuleiroN<B>());
+    for (int row = 0; row < TabuleiroN<B>::LADO; row++) {
+        for (int col = 0; col < TabuleiroN<B>::LADO; col++) {
+            t->set(row, col, grande.get(row, col));
+        }
+    }
+    return t;
+}
+
+template <int B>
+void benchVariante(ExecutorBench& bench) {
+    unique_ptr<TabuleiroN<B> > t = tabuleiroNValido<B>();
+    ostringstream nome;
+    nome << TabuleiroN<B>::LADO << "x" << TabuleiroN<B>::LADO;
+
+    bench.medir("variantes", "validarN/" + nome.str(), 1, [&] {
+        bench.consumir(validarN<B>(*t).numConflitos);
+    });
+    bench.medir("variantes", "validarNParalelo/" + nome.str(), 1, [&] {
+        bench.consumir(validarNParalelo<B>(*t, *ThreadPool::compartilhado()).numConflitos);
+    });
+}
+
+// Validador ladrilhado contra uma tarefa por unidade em um tabuleiro 1024x1024
+void benchGrande(ExecutorBench& bench) {
+    Xoshiro256 rng(SEMENTE_SOLUCOES);
+    TabuleiroGrande tabuleiro(32);
+    tabuleiro.preencherValido(rng);
+
+    ValidadorGrande validador;
+    bench.medir("grande", "ValidadorGrande/ladrilhado/1024x1024", 1, [&] {
+        bench.consumir(validador.validar(tabuleiro).numConflitos);
+    });
+    bench.medir("grande", "ValidadorGrande/umaUnidadePorTarefa/1024x1024", 1, [&] {
+        bench.consumir(validador.validarUmaUnidadePorTarefa(tabuleiro).numConflitos);
+    });
+}
+
+// Motores de solver sobre o corpus de quebra-cabeças difíceis
+void benchSolvers(ExecutorBench& bench, const Corpora& c) {
+    vector<Tabuleiro> trabalho(c.puzzles.size());
+    auto restaurar = [&] {
+        for (size_t i = 0; i < c.puzzles.size(); i++) {
+            trabalho[i] = c.puzzles[i].puzzle;
+        }
+    };
+
+    SolverPropagacao propagacao;
+    bench.medir("solver", "SolverPropagacao", NUM_PUZZLES, [&] {
+        for (Tabuleiro& t : trabalho) {
+            bench.consumir(propagacao.resolver(t));
+        }
+    }, restaurar);
+
+    // ~40KB de nós pré-alocados: fica no heap, não na pilha
+    unique_ptr<SolverDLX> dlx(new SolverDLX());
+    bench.medir("solver", "SolverDLX", NUM_PUZZLES, [&] {
+        for (Tabuleiro& t : trabalho) {
+            bench.consumir(dlx->resolver(t));
+        }
+    }, restaurar);
+
+    bench.medir("solver", "contarSolucoes(limite=2)", NUM_PUZZLES, [&] {
+        for (const PuzzleGerado& p : c.puzzles) {
+            bench.consumir(contarSolucoes(p.puzzle, 2));
+        }
+    });
+
+    // completarMatrizAtual pela classe Sudoku, um quebra-cabeça por repetição
+    const MotorSolver motores[4] = { MotorSolver::BACKTRACKING, MotorSolver::PROPAGACAO, MotorSolver::DLX,
+                                     MotorSolver::PORTFOLIO };
+    const char* nomes[4] = { "BACKTRACKING", "PROPAGACAO", "DLX", "PORTFOLIO" };
+    Sudoku sudoku;
+    for (int m = 0; m < 4; m++) {
+        sudoku.setMotorSolver(motores[m]);
+        int proximo = 0;
+        bench.medir("solver", string("completarMatrizAtual/") + nomes[m], 1, [&] {
+            sudoku.completarMatrizAtual(true);
+            bench.consumir(sudoku.isComplete());
+        }, [&] {
+            const Tabuleiro& p = c.puzzles[proximo++ % NUM_PUZZLES].puzzle;
+            for (int i = 0; i < NUM_CELULAS; i++) {
+                sudoku.setValor(i / LADO_TABULEIRO, i % LADO_TABULEIRO, p.celulas[i]);
+            }
+        });
+    }
+}
+
+// Latência por quebra-cabeça no corpus de casos difíceis: cada estratégia
+// sozinha e o portfólio com todas. Uma repetição resolve um quebra-cabeça
+// (em rodízio), então o p99 mostra a cauda nos casos adversos. As estratégias
+// sozinhas também rodam pelo SolverPortfolio, com o mesmo custo de thread.
+void benchPortfolio(ExecutorBench& bench) {
+    vector<Tabuleiro> casos(TAMANHO_CORPUS_TESTE);
+    for (int k = 0; k < TAMANHO_CORPUS_TESTE; k++) {
+        casos[k].carregarTexto(CORPUS_TESTE[k].puzzle);
+    }
+
+    const EstrategiaSolver estrategias[4] = { EstrategiaSolver::MRV, EstrategiaSolver::DIGITO_RESTRITO,
+                                             EstrategiaSolver::REINICIOS_ALEATORIOS, EstrategiaSolver::DLX };
+    for (int e = 0; e <= 4; e++) {
+        SolverPortfolio portfolio(SEMENTE_PUZZLES);
+        portfolio.setLimiteTentativaInicial(0);
+        if (e < 4) {
+            portfolio.setEstrategias(vector<EstrategiaSolver>(1, estrategias[e]));
+        }
+
+        Tabuleiro t;
+        int proximo = 0;
+        bench.medir("portfolio", e < 4 ? nomeEstrategiaSolver(estrategias[e]) : "corrida", 1, [&] {
+            bench.consumir(portfolio.resolver(t));
+        }, [&] {
+            t = casos[proximo++ % TAMANHO_CORPUS_TESTE];
+        });
+    }
+}
+
+// Contagem de todas as soluções de um tabuleiro com poucas pistas: o primeiro
+// quebra-cabeça do corpus sem as pistas das últimas posições, até ter ao menos
+// 20000 soluções. Sequencial contra paralela e contra o enumerador (que
+// precisam dar o mesmo total).
+void benchContagem(ExecutorBench& bench, const Corpora& c) {
+    const int MIN_SOLUCOES = 20000;
+    Tabuleiro t = c.puzzles[0].puzzle;
+    for (int i = NUM_CELULAS - 1; i >= 0 && contarSolucoes(t, MIN_SOLUCOES) < MIN_SOLUCOES; i--) {
+        t.celulas[i] = 0;
+    }
+
+    int sequencial = contarSolucoes(t, INT_MAX);
+    bench.medir("contagem", "contarSolucoes", sequencial, [&] {
+        bench.consumir(contarSolucoes(t, INT_MAX));
+    });
+
+    ContadorParalelo paralelo;
+    long long total = -1;   // continua -1 se o filtro pular o caso
+    bench.medir("contagem", "ContadorParalelo", sequencial, [&] {
+        total = paralelo.contar(t, LLONG_MAX);
+        bench.consumir(total);
+    });
+    if (total >= 0 && total != sequencial) {
+        cerr << "contagem: ContadorParalelo encontrou " << total << " soluções, a sequencial "
+             << sequencial << endl;
+    }
+
+    // As mesmas soluções uma a uma, pelo enumerador com pilha explícita
+    long long entregues = -1;
+    bench.medir("contagem", "EnumeradorSolucoes", sequencial, [&] {
+        EnumeradorSolucoes enumerador(t);
+        Tabuleiro solucao;
+        while (enumerador.proxima(solucao)) {
+            bench.consumir(solucao.celulas[0]);
+        }
+        entregues = enumerador.getEntregues();
+    });
+    if (entregues >= 0 && entregues != sequencial) {
+        cerr << "contagem: EnumeradorSolucoes entregou " << entregues << " soluções, a sequencial "
+             << sequencial << endl;
+    }
+}
+
+// Gerador serial e fábrica paralela
+void benchGerador(ExecutorBench& bench) {
+    GeradorPuzzles gerador(SEMENTE_PUZZLES);
+    bench.medir("gerador", "GeradorPuzzles/MEDIO", 1, [&] {
+        bench.consumir(gerador.gerar(pistasAlvo(Dificuldade::MEDIO)).celulas[0]);
+    });
+
+    const int quantidade = 32;
+    FabricaPuzzles fabrica(SEMENTE_PUZZLES);
+    bench.medir("gerador", "FabricaPuzzles/MEDIO", quantidade, [&] {
+        bench.consumir(fabrica.gerar(quantidade, Dificuldade::MEDIO).size());
+    });
+}
+
+void imprimirUso() {
+    cout << "Uso: sudoku_bench [--aquecimento N] [--repeticoes N] [--filtro texto]\n"
+         << "                  [--csv arquivo] [--json arquivo]" << endl;
+}
+
+int main(int argc, char* argv[]) {
+    int aquecimento = 3;
+    int repeticoes = 30;
+    string filtro, arquivoCSV, arquivoJSON;
+
+    for (int i = 1; i < argc; i++) {
+        bool temValor = i + 1 < argc;
+        if (strcmp(argv[i], "--aquecimento") == 0 && temValor) {
+            aquecimento = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--repeticoes") == 0 && temValor) {
+            repeticoes = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--filtro") == 0 && temValor) {
+            filtro = argv[++i];
+        } else if (strcmp(argv[i], "--csv") == 0 && temValor) {
+            arquivoCSV = argv[++i];
+        } else if (strcmp(argv[i], "--json") == 0 && temValor) {
+            arquivoJSON = argv[++i];
+        } else {
+            imprimirUso();
+            return 1;
+        }
+    }
+
+    ostringstream maquina;
+    maquina << ThreadPool::compartilhado()->numThreads() << " threads no pool, kernel de máscaras "
+            << nomeKernelMascara(kernelMascaraAtivo());
+
+    cerr << "Montando corpora (sementes fixas)..." << endl;
+    Corpora corpora = montarCorpora();
+
+    cerr << "Executando " << aquecimento << " aquecimentos + " << repeticoes
+         << " repetições por caso (" << maquina.str() << ")" << endl;
+    // Só avisos e erros: as mensagens de progresso não entram nas medições
+    LogAssincrono::global().setNivel(NivelLog::AVISO);
+
+    ExecutorBench bench(aquecimento, repeticoes);
+    bench.setFiltro(filtro);
+
+    benchValidacaoSudoku(bench);
+    benchValidacaoLote(bench, corpora);
+    benchCorpus(bench, corpora);
+    benchVizinhanca(bench, corpora);
+    benchVariante<4>(bench);
+    benchVariante<8>(bench);
+    benchGrande(bench);
+    benchSolvers(bench, corpora);
+    benchPortfolio(bench);
+    benchContagem(bench, corpora);
+    benchGerador(bench);
+
+    cout << endl;
+    bench.imprimirTabela(cout);
+
+    if (!arquivoCSV.empty()) {
+        ofstream csv(arquivoCSV.c_str());
+        bench.escreverCSV(csv);
+        cout << "CSV escrito em " << arquivoCSV << endl;
+    }
+    if (!arquivoJSON.empty()) {
+        ofstream json(arquivoJSON.c_str());
+        bench.escreverJSON(json, maquina.str());
+        cout << "JSON escrito em " << arquivoJSON << endl;
+    }
+    return 0;
+}
@@ -1,6 +1,22 @@
 #include <iostream>
 #include <limits>
+#include <cstring>
+#include <cstdlib>
+#include <climits>
 #include "Sudoku/Sudoku.h"
+#include "Solver/CorpusTeste.h"
+#include "Solver/ContadorSolucoes.h"
+#include "Solver/EnumeradorSolucoes.h"
+#include "Gerador/FabricaPuzzles.h"
+#include "Gerador/GeradorN.h"
+#include "Validador/ValidadorN.h"
+#include "Solver/SolverN.h"
+#include "Validador/ValidadorGrande.h"
+#include "Trace/Rastreador.h"
+#include "Fluxo/ProcessadorFluxo.h"
+#include <fstream>
+#include <algorithm>
+#include <vector>
 
 using namespace std;
 
@@ -38,7 +54,7 @@ Dificuldade escolherDificuldade() {
     }
 }
 
-void jogarSudoku() {
+void jogarSudoku(bool contadoresHardware) {
     limparTela();
     cout << "===== JOGO DE SUDOKU =====" << endl;
     
@@ -47,6 +63,7 @@ void jogarSudoku() {
     
     // Criar jogo
     Sudoku jogo(nivel);
+    jogo.setContadoresHardware(contadoresHardware);
     
     bool jogando = true;
     
@@ -104,12 +121,13 @@ void jogarSudoku() {
                 int escolhaVerificacao = 0;
                 cout << "Como deseja verificar o tabuleiro?" << endl;
                 cout << "1. Verificação simples (1 thread)" << endl;
-                cout << "2. Verificação paralela (11 threads)" << endl;
-                cout << "3. Verificação paralela detalhada (27 threads)" << endl;
-                cout << "Sua escolha (1-3): ";
+                cout << "2. Verificação paralela (11 tarefas no pool de threads)" << endl;
+                cout << "3. Verificação paralela detalhada (27 tarefas no pool de threads)" << endl;
+                cout << "4. Verificação por máscaras de bits (SIMD)" << endl;
+                cout << "Sua escolha (1-4): ";
                 cin >> escolhaVerificacao;
 
-                if (cin.fail() || escolhaVerificacao < 1 || escolhaVerificacao > 3) {
+                if (cin.fail() || escolhaVerificacao < 1 || escolhaVerificacao > 4) {
                     cin.clear();
                     cin.ignore(numeric_limits<streamsize>::max(), '\n');
                     cout << "Opção inválida! Usando verificação simples." << endl;
@@ -119,17 +137,22 @@ void jogarSudoku() {
                 if (escolhaVerificacao == 1) {
                     // Verificação simples
                     jogo.iniciarValidacao();
+                    bool valido = jogo.isValidThread();
                     cout << "\nVerificação: O tabuleiro é "
-                        << (jogo.isValidThread() ? "válido" : "inválido") << endl;
+                        << (valido ? "válido" : "inválido") << endl;
                 }
                 else if (escolhaVerificacao == 2) {
-                    // Verificação paralela estática (11 threads)
+                    // Verificação paralela estática (11 tarefas)
                     jogo.iniciarValidacaoParalela();
                 }
-                else {
-                    // Verificação paralela detalhada (27 threads)
+                else if (escolhaVerificacao == 3) {
+                    // Verificação paralela detalhada (27 tarefas)
                     jogo.iniciarValidacaoParalelaDetalhada();
                 }
+                else {
+                    // Verificação por máscaras de bits (27 unidades de uma vez)
+                    jogo.iniciarValidacaoMascara();
+                }
 
                 // Mostrar log detalhado após a verificação
                 jogo.imprimirLogValidacao();
@@ -144,10 +167,12 @@ void jogarSudoku() {
                 cout << "Como deseja completar o tabuleiro?" << endl;
                 cout << "1. Com valores válidos (solução correta)" << endl;
                 cout << "2. Com valores aleatórios (pode ser inválido)" << endl;
-                cout << "Sua escolha (1-2): ";
+                cout << "3. Com valores válidos usando Dancing Links (DLX)" << endl;
+                cout << "4. Com valores válidos usando o portfólio (estratégias em paralelo)" << endl;
+                cout << "Sua escolha (1-4): ";
                 cin >> escolhaCompletar;
                 
-                if (cin.fail() || (escolhaCompletar != 1 && escolhaCompletar != 2)) {
+                if (cin.fail() || escolhaCompletar < 1 || escolhaCompletar > 4) {
                     cin.clear();
                     cin.ignore(numeric_limits<streamsize>::max(), '\n');
                     cout << "Opção inválida! Pressione Enter para continuar...";
@@ -155,7 +180,18 @@ void jogarSudoku() {
                     cin.get();
                 } else {
                     // Completar com valores válidos (true) ou aleatórios (false)
-                    jogo.completarMatrizAtual(escolhaCompletar == 1);
+                    jogo.setMotorSolver(escolhaCompletar == 3 ? MotorSolver::DLX
+                                        : escolhaCompletar == 4 ? MotorSolver::PORTFOLIO
+                                        : MotorSolver::PROPAGACAO);
+                    jogo.completarMatrizAtual(escolhaCompletar != 2);
+                    if (escolhaCompletar == 4) {
+                        ResultadoPortfolio resultado = jogo.getUltimoResultadoPortfolio();
+                        cout << "Estratégia vencedora: " << nomeEstrategiaSolver(resultado.vencedora)
+                             << (resultado.corrida ? "" : " (tentativa inicial, sem corrida)") << endl;
+                        cout << "Pressione Enter para continuar...";
+                        cin.ignore(numeric_limits<streamsize>::max(), '\n');
+                        cin.get();
+                    }
                 }
                 break;
             }
@@ -178,7 +214,386 @@ void jogarSudoku() {
     cout << "Obrigado por jogar Sudoku!" << endl;
 }
 
-int main() {
-    jogarSudoku();
+// Gera, valida em paralelo e resolve um quebra-cabeça N x N (N = B * B)
+template <int B>
+int executarVariante(uint64_t semente) {
+    typedef TabuleiroN<B> T;
+    const int N = T::LADO;
+
+    // Os tabuleiros grandes passam de 4KB: ficam no heap
+    unique_ptr<T> solucao(new T());
+    unique_ptr<T> puzzle(new T());
+
+    auto inicio = chrono::high_resolution_clock::now();
+    GeradorPuzzlesN<B> gerador(semente);
+    *puzzle = gerador.gerar(pistasAlvo(Dificuldade::FACIL, T::NUM_CELULAS), solucao.get());
+    auto geracao = chrono::duration_cast<chrono::milliseconds>(chrono::high_resolution_clock::now() - inicio);
+
+    cout << "Quebra-cabeça " << N << "x" << N << " com " << puzzle->numPistas()
+         << " pistas (gerado em " << geracao.count() << "ms, "
+         << gerador.getNumContagens() << " contagens de soluções):" << endl;
+    imprimirTabuleiroN<B>(cout, *puzzle);
+
+    ValidacaoStats stats;
+    ResultadoMascara r = validarNParalelo<B>(*solucao, *ThreadPool::compartilhado(), &stats);
+    cout << "\n[Validação] Solução " << (r.resultado == ResultadoValidacao::VALIDO ? "válida" : "inválida")
+         << ": " << T::NUM_UNIDADES << " unidades em " << stats.numTarefas << " tarefas, "
+         << stats.tempoEmNs.count() << "ns" << endl;
+
+    SolverPropagacaoN<B> solver;
+    unique_ptr<T> resolvido(new T(*puzzle));
+    bool ok = solver.resolver(*resolvido) &&
+              memcmp(resolvido->celulas, solucao->celulas, sizeof(resolvido->celulas)) == 0;
+    cout << "[Solver] " << (ok ? "Resolvido" : "Falhou") << " em "
+         << solver.getEstatisticas().tempoEmNs.count() << "ns, "
+         << solver.getEstatisticas().nosVisitados << " nós visitados." << endl;
+    return ok ? 0 : 1;
+}
+
+// Compara o validador ladrilhado com uma tarefa por unidade em um tabuleiro grande
+int compararValidadoresGrandes(int ladoBloco, int repeticoes) {
+    Xoshiro256 rng(1);
+    TabuleiroGrande tabuleiro(ladoBloco);
+    tabuleiro.preencherValido(rng);
+
+    ValidadorGrande validador;
+    vector<long long> ladrilhado, porUnidade;
+    bool confere = true;
+    for (int i = 0; i < repeticoes; i++) {
+        ResultadoMascara a = validador.validar(tabuleiro);
+        ladrilhado.push_back(validador.getUltimasStats().tempoEmNs.count());
+        ResultadoMascara b = validador.validarUmaUnidadePorTarefa(tabuleiro);
+        porUnidade.push_back(validador.getUltimasStats().tempoEmNs.count());
+        confere = confere && a.resultado == b.resultado && a.numConflitos == b.numConflitos;
+    }
+    sort(ladrilhado.begin(), ladrilhado.end());
+    sort(porUnidade.begin(), porUnidade.end());
+
+    int n = tabuleiro.getLado();
+    cout << "Tabuleiro " << n << "x" << n << " (" << tabuleiro.getNumCelulas() * 2 / 1024 << " KB), "
+         << ThreadPool::compartilhado()->numThreads() << " threads, " << repeticoes << " repetições" << endl;
+    cout << "  ladrilhado:          mín " << ladrilhado.front() / 1000 << " us, mediana "
+         << ladrilhado[ladrilhado.size() / 2] / 1000 << " us" << endl;
+    cout << "  uma unidade/tarefa:  mín " << porUnidade.front() / 1000 << " us, mediana "
+         << porUnidade[porUnidade.size() / 2] / 1000 << " us" << endl;
+    cout << "  resultados " << (confere ? "conferem" : "DIVERGEM") << endl;
+    return confere ? 0 : 1;
+}
+
+// Conta as soluções de um tabuleiro com a busca sequencial e com a paralela
+int compararContagens(const char* texto, long long limite) {
+    Tabuleiro tabuleiro;
+    if (!tabuleiro.carregarTexto(texto)) {
+        cout << "Tabuleiro inválido: use 81 caracteres (1-9, '.' ou 0 para vazio)." << endl;
+        return 1;
+    }
+
+    auto inicio = chrono::high_resolution_clock::now();
+    int sequencial = contarSolucoes(tabuleiro, static_cast<int>(min<long long>(limite, INT_MAX)));
+    auto duracao = chrono::duration_cast<chrono::microseconds>(chrono::high_resolution_clock::now() - inicio);
+
+    ContadorParalelo paralelo;
+    long long total = paralelo.contar(tabuleiro, limite);
+    const EstatisticasContagem& stats = paralelo.getEstatisticas();
+
+    cout << "Soluções (limite " << limite << ")" << endl;
+    cout << "  sequencial: " << sequencial << " em " << duracao.count() << " us" << endl;
+    cout << "  paralela:   " << total << " em "
+         << chrono::duration_cast<chrono::microseconds>(stats.tempoEmNs).count() << " us, "
+         << stats.numTrabalhadores << " trabalhadores, " << stats.subarvoresIniciais << " subárvores iniciais, "
+         << stats.subarvoresDoadas << " doadas, " << stats.subarvoresRoubadas << " roubadas" << endl;
+    cout << "  por trabalhador (antes do corte no limite):";
+    for (long long n : stats.solucoesPorTrabalhador) {
+        cout << " " << n;
+    }
+    cout << endl;
+
+    // A sequencial conta em int: acima de INT_MAX só dá para comparar até lá
+    bool confere = min<long long>(total, INT_MAX) == sequencial;
+    cout << "  resultados " << (confere ? "conferem" : "DIVERGEM") << endl;
+    return confere ? 0 : 1;
+}
+
+// Escreve até k soluções (k <= 0: todas), uma por linha, e na saída de erro
+// o ponto para continuar a enumeração com --retomar
+int escreverSolucoes(EnumeradorSolucoes& enumerador, long long k) {
+    if (!enumerador.isValido()) {
+        cerr << "Ponto de retomada inválido para este tabuleiro." << endl;
+        return 1;
+    }
+
+    long long escritas = 0;
+    char texto[82];
+    for (const Tabuleiro& solucao : enumerador) {
+        solucao.paraTexto(texto);
+        cout << texto << '\n';
+        if (++escritas == k) {
+            break;
+        }
+    }
+    cout.flush();
+
+    if (enumerador.terminou()) {
+        cerr << "Enumeração concluída: " << enumerador.getEntregues() << " soluções." << endl;
+    } else {
+        cerr << enumerador.getEntregues() << " soluções até aqui. Para continuar:" << endl
+             << "  --retomar \"" << enumerador.pontoRetomada().paraTexto() << "\"" << endl;
+    }
+    return 0;
+}
+
+// Modo não interativo: --fluxo <validar|resolver|contar|gerar> [opções].
+// Lê tabuleiros de 81 caracteres por linha da entrada padrão (ou de
+// --entrada arquivo) e escreve um resultado por linha na saída padrão, na
+// ordem da entrada; o resumo vai para a saída de erro.
+int executarFluxo(int argc, char* argv[]) {
+    ConfigFluxo config;
+    string arquivoEntrada, arquivoCorpus;
+    bool ok = argc > 2 && lerOperacaoFluxo(argv[2], config.operacao);
+
+    for (int i = 3; ok && i < argc; i++) {
+        bool temValor = i + 1 < argc;
+        if (strcmp(argv[i], "--entrada") == 0 && temValor) {
+            arquivoEntrada = argv[++i];
+        } else if (strcmp(argv[i], "--corpus") == 0 && temValor) {
+            arquivoCorpus = argv[++i];
+        } else if (strcmp(argv[i], "--limite") == 0 && temValor) {
+            config.limiteContagem = atoi(argv[++i]);
+            ok = config.limiteContagem >= 1;
+        } else if (strcmp(argv[i], "--quantidade") == 0 && temValor) {
+            config.quantidade = atoll(argv[++i]);
+        } else if (strcmp(argv[i], "--nivel") == 0 && temValor) {
+            i++;
+            if (strcmp(argv[i], "facil") == 0) {
+                config.nivel = Dificuldade::FACIL;
+            } else if (strcmp(argv[i], "medio") == 0) {
+                config.nivel = Dificuldade::MEDIO;
+            } else if (strcmp(argv[i], "dificil") == 0) {
+                config.nivel = Dificuldade::DIFICIL;
+            } else {
+                ok = false;
+            }
+        } else if (strcmp(argv[i], "--semente") == 0 && temValor) {
+            config.semente = strtoull(argv[++i], nullptr, 10);
+        } else if (strcmp(argv[i], "--bloco") == 0 && temValor) {
+            config.linhasPorBloco = atoi(argv[++i]);
+            ok = config.linhasPorBloco >= 1;
+        } else {
+            ok = false;
+        }
+    }
+
+    if (!ok) {
+        cerr << "Uso: --fluxo <validar|resolver|contar|gerar> [--entrada arquivo | --corpus arquivo.sdkc]\n"
+             << "             [--limite N] [--quantidade N] [--nivel facil|medio|dificil] [--semente S] [--bloco N]" << endl;
+        return 1;
+    }
+
+    // A saída padrão é só dos resultados: nada de mensagens de progresso
+    LogAssincrono::global().setNivel(NivelLog::AVISO);
+    ios::sync_with_stdio(false);
+
+    ifstream arquivo;
+    if (!arquivoEntrada.empty()) {
+        arquivo.open(arquivoEntrada.c_str());
+        if (!arquivo) {
+            cerr << "Não foi possível abrir " << arquivoEntrada << endl;
+            return 1;
+        }
+    }
+
+    ProcessadorFluxo processador(config);
+    ResumoFluxo resumo;
+    if (!arquivoCorpus.empty()) {
+        CorpusBinario corpus;
+        if (config.operacao == OperacaoFluxo::GERAR || !corpus.abrir(arquivoCorpus)) {
+            cerr << (corpus.getErro().empty() ? "--corpus não se aplica a gerar" : corpus.getErro()) << endl;
+            return 1;
+        }
+        resumo = processador.executar(corpus, cout);
+    } else {
+        resumo = processador.executar(arquivoEntrada.empty() ? cin : arquivo, cout);
+    }
+    ProcessadorFluxo::imprimirResumo(cerr, resumo);
+    return resumo.erros > 0 || resumo.divergencias > 0 ? 2 : 0;
+}
+
+// Converte um arquivo de texto ("-" = entrada padrão) em corpus binário.
+// Cada linha tem o quebra-cabeça e, opcionalmente, a solução separada por
+// espaço; se a primeira linha tiver solução, todas precisam ter.
+int criarCorpus(const string& arquivoTexto, const string& arquivoCorpus) {
+    ifstream arquivo;
+    if (arquivoTexto != "-") {
+        arquivo.open(arquivoTexto.c_str());
+        if (!arquivo) {
+            cerr << "Não foi possível abrir " << arquivoTexto << endl;
+            return 1;
+        }
+    }
+    istream& entrada = arquivoTexto == "-" ? cin : arquivo;
+
+    EscritorCorpus escritor;
+    bool criado = false;
+    string linha;
+    long long numeroLinha = 0;
+    Tabuleiro puzzle, solucao;
+    while (getline(entrada, linha)) {
+        numeroLinha++;
+        if (!linha.empty() && linha[linha.size() - 1] == '\r') {
+            linha.erase(linha.size() - 1);
+        }
+        if (linha.empty() || linha[0] == '#') {
+            continue;
+        }
+
+        bool comSolucao = linha.size() >= 163 && (linha[81] == ' ' || linha[81] == '\t');
+        if ((linha.size() != 81 && !comSolucao) || !puzzle.carregarTexto(linha.c_str()) ||
+            (comSolucao && !solucao.carregarTexto(linha.c_str() + 82))) {
+            cerr << "Linha " << numeroLinha << " mal formada" << endl;
+            return 1;
+        }
+        if (!criado) {
+            if (!escritor.criar(arquivoCorpus, comSolucao)) {
+                cerr << escritor.getErro() << endl;
+                return 1;
+            }
+            criado = true;
+        }
+        if (!escritor.adicionar(puzzle, comSolucao ? &solucao : nullptr)) {
+            cerr << "Linha " << numeroLinha << ": " << escritor.getErro() << endl;
+            return 1;
+        }
+    }
+
+    if (!criado && !escritor.criar(arquivoCorpus, false)) {
+        cerr << escritor.getErro() << endl;
+        return 1;
+    }
+    size_t total = escritor.tamanho();
+    if (!escritor.fechar()) {
+        cerr << escritor.getErro() << endl;
+        return 1;
+    }
+    cerr << total << " tabuleiros gravados em " << arquivoCorpus << endl;
+    return 0;
+}
+
+// Salva a linha do tempo ao sair do main, por qualquer caminho de retorno
+struct SalvarRastreio {
+    string arquivo;
+
+    ~SalvarRastreio() {
+        if (arquivo.empty()) return;
+        LogAssincrono::global().descarregar();
+        if (Rastreador::global().salvar(arquivo)) {
+            cout << "Linha do tempo salva em " << arquivo << " (abra em https://ui.perfetto.dev)" << endl;
+        } else {
+            cout << "Não foi possível escrever " << arquivo << endl;
+        }
+    }
+};
+
+int main(int argc, char* argv[]) {
+    // --rastreio arquivo.json (em qualquer posição) grava a linha do tempo de
+    // validações, solver e gerador no formato trace_event do Chrome
+    SalvarRastreio rastreio;
+    for (int i = 1; i + 1 < argc; i++) {
+        if (strcmp(argv[i], "--rastreio") == 0) {
+            rastreio.arquivo = argv[i + 1];
+            for (int j = i; j + 2 <= argc; j++) {
+                argv[j] = argv[j + 2];
+            }
+            argc -= 2;
+            Rastreador::global().ativar();
+            Rastreador::global().nomearThread("principal");
+            break;
+        }
+    }
+
+    // Processamento em fluxo, sem menus (para uso em pipelines)
+    if (argc > 1 && strcmp(argv[1], "--fluxo") == 0) {
+        return executarFluxo(argc, argv);
+    }
+
+    // Conversão de texto para corpus binário: --criar-corpus <texto|-> <arquivo.sdkc>
+    if (argc > 3 && strcmp(argv[1], "--criar-corpus") == 0) {
+        return criarCorpus(argv[2], argv[3]);
+    }
+
+    // Conferência dos motores de solver contra o corpus compartilhado
+    if (argc > 1 && strcmp(argv[1], "--verificar-solvers") == 0) {
+        return verificarMotoresSolver(cout) ? 0 : 1;
+    }
+
+    // Geração em lote: N quebra-cabeças por nível, reproduzível pela semente
+    if (argc > 2 && strcmp(argv[1], "--fabricar") == 0) {
+        int quantidade = atoi(argv[2]);
+        uint64_t semente = argc > 3 ? strtoull(argv[3], nullptr, 10) : 1;
+        FabricaPuzzles fabrica(semente);
+        const Dificuldade niveis[3] = { Dificuldade::FACIL, Dificuldade::MEDIO, Dificuldade::DIFICIL };
+        for (Dificuldade nivel : niveis) {
+            fabrica.gerar(quantidade, nivel);
+        }
+        fabrica.imprimirRelatorio(cout);
+        return 0;
+    }
+
+    // Contagem de soluções sequencial x paralela: --contar <tabuleiro> [limite]
+    if (argc > 2 && strcmp(argv[1], "--contar") == 0) {
+        long long limite = argc > 3 ? strtoll(argv[3], nullptr, 10) : INT_MAX;
+        return compararContagens(argv[2], limite);
+    }
+
+    // Enumeração sob demanda: --enumerar <tabuleiro> [k] e --retomar "<ponto>" [k]
+    if (argc > 2 && (strcmp(argv[1], "--enumerar") == 0 || strcmp(argv[1], "--retomar") == 0)) {
+        long long k = argc > 3 ? strtoll(argv[3], nullptr, 10) : 0;
+        if (strcmp(argv[1], "--enumerar") == 0) {
+            Tabuleiro tabuleiro;
+            if (!tabuleiro.carregarTexto(argv[2])) {
+                cerr << "Tabuleiro inválido: use 81 caracteres (1-9, '.' ou 0 para vazio)." << endl;
+                return 1;
+            }
+            EnumeradorSolucoes enumerador(tabuleiro);
+            return escreverSolucoes(enumerador, k);
+        }
+        PontoRetomada ponto;
+        if (!ponto.carregarTexto(argv[2])) {
+            cerr << "Ponto de retomada mal formado." << endl;
+            return 1;
+        }
+        EnumeradorSolucoes enumerador(ponto);
+        return escreverSolucoes(enumerador, k);
+    }
+
+    // Variantes maiores: --variante B [semente], com B = 3, 4, 5, 6 ou 8
+    if (argc > 2 && strcmp(argv[1], "--variante") == 0) {
+        int b = atoi(argv[2]);
+        uint64_t semente = argc > 3 ? strtoull(argv[3], nullptr, 10) : 1;
+        switch (b) {
+            case 3: return executarVariante<3>(semente);
+            case 4: return executarVariante<4>(semente);
+            case 5: return executarVariante<5>(semente);
+            case 6: return executarVariante<6>(semente);
+            case 8: return executarVariante<8>(semente);
+            default:
+                cout << "Tamanho de bloco não suportado (use 3, 4, 5, 6 ou 8)." << endl;
+                return 1;
+        }
+    }
+
+    // Benchmark do validador de tabuleiros grandes: --bench-grande [B] [repetições]
+    if (argc > 1 && strcmp(argv[1], "--bench-grande") == 0) {
+        int ladoBloco = argc > 2 ? atoi(argv[2]) : 64;
+        int repeticoes = argc > 3 ? atoi(argv[3]) : 5;
+        if (ladoBloco < 2 || ladoBloco > 255 || repeticoes < 1) {
+            cout << "Uso: --bench-grande [B entre 2 e 255] [repetições >= 1]" << endl;
+            return 1;
+        }
+        return compararValidadoresGrandes(ladoBloco, repeticoes);
+    }
+
+    // Jogo interativo; --contadores mede contadores de hardware em cada validação
+    bool contadoresHardware = argc > 1 && strcmp(argv[1], "--contadores") == 0;
+    jogarSudoku(contadoresHardware);
     return 0;
 }